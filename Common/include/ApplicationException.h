@@ -81,6 +81,10 @@ using	namespace	utility_space;
 			//!	length.
 		INVALID_VOTES_FILE_LENGTH,
 
+			//!	The file containing the locks of the records
+			//!	has invalid length.
+		INVALID_LOCKS_FILE_LENGTH,
+
 			//!	The key used to encrypt the voters' indices is
 			//!	invalid.
 		INVALID_VOTERS_KEY,
@@ -161,6 +165,37 @@ using	namespace	utility_space;
 			//!	valid.
 		INVALID_KEY_FILE_FORMAT,
 
+			//!	The cipher engine of the election is not
+			//!	supported by the processor.
+		UNSUPPORTED_CIPHER_ENGINE,
+
+			//!	The number of votes between disk
+			//!	synchronizations is zero or greater than the
+			//!	maximum valid value.
+		INVALID_SYNCHRONIZATION_VOTES,
+
+			//!	The minimum number of votes modified when a vote
+			//!	is written is outside the valid range.
+		INVALID_DECOY_VOTES,
+
+			//!	The number of votes modified at each iteration
+			//!	of the noise generation is zero or greater than
+			//!	the maximum valid value.
+		INVALID_SWEEP_VOTES,
+
+			//!	The number of files the votes are split into is
+			//!	zero or greater than the maximum valid value or
+			//!	the number of voters.
+		INVALID_SHARDS,
+
+			//!	The number of threads used to compute the result
+			//!	is zero or greater than the maximum valid value.
+		INVALID_THREADS,
+
+			//!	The file containing the generations of the votes
+			//!	has invalid length.
+		INVALID_GENERATIONS_FILE_LENGTH,
+
 			//!	Dummy value to mark the end of enumerated type:
 			//!	do not use.
 		LAST_APPLICATION_EXCEPTION
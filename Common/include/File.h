@@ -34,6 +34,10 @@
 //!	Max buffer size for Open.
 # define	MAXIMUM_BUFFER_SIZE		(static_cast<std_uint>(0xFFFF))
 
+//! \def	INPUT_BUFFER_SIZE
+//!	Size of the buffer of the bytes read ahead from standard input.
+# define	INPUT_BUFFER_SIZE		(static_cast<std_uint>(4096))
+
 //! \def	FILE_CLOSE_OK
 //!	Valure returned by fclose when the operation succeeds.
 # define	FILE_CLOSE_OK			0
@@ -201,6 +205,23 @@ class	File
 //!	Kind of latest operation performed on the file.
 				OperationKind	LastOperation;
 
+//! \property	InputBuffer
+//!	Buffer of the bytes read ahead from standard input, or NULL for the
+//!	other files, that are read through the buffer of their stream.
+				byte*		InputBuffer;
+
+//! \property	InputStart
+//!	Index of the first byte of InputBuffer not yet returned.
+				std_uint	InputStart;
+
+//! \property	InputEnd
+//!	Index following the last byte read ahead into InputBuffer.
+				std_uint	InputEnd;
+
+//! \property	InputEnded
+//!	True if the end of standard input has been reached.
+				bool		InputEnded;
+
 //! \property	NoPathName
 //!	Default name for exception generation.
 		static	const	CharString	NoPathName;
@@ -227,6 +248,12 @@ class	File
 			const	File&		operator = (File&& thisFile)
 							noexcept = delete;
 
+				std_uint	ReadInput(byte* Destination,
+							std_uint Size,
+							std_uint Count)
+							throw(FatalException,
+							IOException);
+
 	protected:
 
 				void		Open(const CharString&
@@ -326,6 +353,11 @@ class	File
 							throw(FatalException,
 							IOException);
 
+				bool		IsInputReady(std_uint Timeout)
+							const
+							throw(FatalException,
+							IOException);
+
 				void		Write(const void* Source,
 							std_uint Size,
 							std_uint Count)
@@ -382,6 +414,61 @@ class	File
 							throw(FatalException,
 							IOException);
 
+				void		LockAt(std_ulong Offset,
+							std_uint Size) const
+							throw(FatalException,
+							IOException);
+
+				void		UnlockAt(std_ulong Offset,
+							std_uint Size) const
+							throw(FatalException,
+							IOException);
+
+				void		Truncate(std_ulong Size)
+							throw(FatalException,
+							IOException);
+
+				std_uint	ReadAt(void* Destination,
+							std_uint Size,
+							std_ulong Offset)
+							throw(FatalException,
+							IOException);
+
+				void		WriteAt(const void* Source,
+							std_uint Size,
+							std_ulong Offset)
+							throw(FatalException,
+							IOException);
+
+				bool		IsBatchAsynchronous(void) const
+							throw(FatalException);
+
+				void		ReadBatch(const BatchTransfer*
+							Transfers,
+							std_uint Count)
+							throw(FatalException,
+							IOException);
+
+				void		WriteBatch(const BatchTransfer*
+							Transfers,
+							std_uint Count)
+							throw(FatalException,
+							IOException);
+
+				void*		Map(std_ulong Size)
+							throw(FatalException,
+							IOException);
+
+				void		Unmap(void* Address,
+							std_ulong Size) const
+							throw(FatalException);
+
+				void		SynchronizeMap(const void*
+							Address, std_ulong Size)
+							const
+							throw(FatalException,
+							IOException);
+
 	};
 
 }
@@ -142,7 +142,9 @@ INLINE	bool	File::Open(const CharString& thisPathName,
 
 INLINE	File::File(void) throw(FatalException): PathName(),
 		FileHandle(static_cast<FILE *>(NULL)), Mode(NOT_OPEN),
-		LastOperation(OPERATION_NONE)
+		LastOperation(OPERATION_NONE),
+		InputBuffer(static_cast<byte *>(NULL)), InputStart(0),
+		InputEnd(0), InputEnded(false)
 	{
 	}
 
@@ -421,7 +423,12 @@ INLINE	bool	File::OpenText(const CharString& thisPathName,
 //!
 //! \note
 //!	stdin must be already open as text file in read mode when the function
-//!	is called, otherwise I/O operations on this File will fail.
+//!	is called, otherwise I/O operations on this File will fail. \n
+//!	The File reads standard input from its file descriptor, through a
+//!	buffer of its own, so that IsInputReady knows the bytes already read
+//!	ahead; stdin must not be read by other means while the File is open.
+//!
+//! \see	INPUT_BUFFER_SIZE
 //!
 ////////////////////////////////////////////////////////////////////////////////
 
@@ -429,6 +436,9 @@ INLINE	void	File::OpenInput(void) throw(FatalException, IOException)
 	{
 	if (Mode != NOT_OPEN)
 		throw make_IO_exception(FILE_ALREADY_OPEN, PathName);
+	InputBuffer = new byte [INPUT_BUFFER_SIZE];
+	InputStart = InputEnd = 0;
+	InputEnded = false;
 	PathName = CharString(DEFAULT_STDIN_PATHNAME);
 	FileHandle = stdin;
 	Mode = OPEN_READ;
@@ -521,10 +531,123 @@ INLINE	void	File::Close(void) throw(FatalException, IOException)
 	if (FileHandle != stdin && FileHandle != stdout && FileHandle != stderr)
 		if (fclose(FileHandle) != FILE_CLOSE_OK)
 			throw make_IO_exception(FILE_CLOSE_ERROR, PathName);
+	delete [] InputBuffer;
+	InputBuffer = static_cast<byte *>(NULL);
 	FileHandle = static_cast<FILE *>(NULL);
 	Mode = NOT_OPEN;
 	}
 
+////////////////////////////////////////////////////////////////////////////////
+//! \par	Description:
+//!	Wait until some bytes can be read without blocking, or a given time
+//!	elapses.
+//!
+//! \param	Timeout				Maximum waiting time, in
+//!						milliseconds; if 0, the function
+//!						does not wait.
+//!
+//! \throw	utility_space::OUT_OF_MEMORY	If memory allocation fails when
+//!						creating an exception.
+//! \throw	io_space::FILE_NOT_OPEN		If the File is not opened in
+//!						read or read-write or update
+//!						mode.
+//! \throw	io_space::FILE_READ_ERROR	If an error occurs while
+//!						waiting.
+//!
+//! \returns	bool				true if some bytes, or the end
+//!						of file, can be read, false if
+//!						the time elapsed.
+//!
+//! \note
+//!	Reading from a pipe or a terminal blocks until the writer sends some
+//!	bytes; the function allows a program to do something else when no input
+//!	is ready. \n
+//!	Only standard input is checked, since only its read-ahead buffer is
+//!	owned by the File: the file descriptor is polled when the buffer is
+//!	empty. The other files are always reported as ready, so that the caller
+//!	reads as it would without checking.
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+INLINE	bool	File::IsInputReady(std_uint Timeout) const
+			throw(FatalException, IOException)
+	{
+	switch (Mode)
+		{
+		case OPEN_READ:
+		case OPEN_READ_WRITE:
+		case OPEN_UPDATE:
+			break;
+		default:
+			throw make_IO_exception(FILE_NOT_OPEN, PathName);
+		}
+	if (InputBuffer == static_cast<byte *>(NULL) ||
+		InputStart < InputEnd || InputEnded)
+		return true;
+	return FileManager::GetInstance()->IsInputReady(fileno(FileHandle),
+		Timeout, PathName);
+	}
+
+////////////////////////////////////////////////////////////////////////////////
+//! \par	Description:
+//!	Read up to Count items of Size bytes from standard input, through the
+//!	read-ahead buffer, and stores them in Destination.
+//!
+//! \param	Destination			Storage location for data.
+//! \param	Size				Item size in bytes.
+//! \param	Count				Maximum number of items to be
+//!						read.
+//!
+//! \throw	utility_space::OUT_OF_MEMORY	If memory allocation fails when
+//!						creating an exception.
+//! \throw	io_space::FILE_READ_ERROR	If an error occurs while
+//!						reading.
+//!
+//! \returns	std_uint			The number of full items
+//!						actually read, which may be less
+//!						than Count if the end of the
+//!						file is encountered before
+//!						having read Count items.
+//!
+//! \note
+//!	The buffer is filled only when it is empty, with the bytes available
+//!	at that time; once the end of file is reached, no further read is
+//!	attempted.
+//!
+//! \see	INPUT_BUFFER_SIZE
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+INLINE	std_uint	File::ReadInput(byte* Destination, std_uint Size,
+				std_uint Count)
+				throw(FatalException, IOException)
+	{
+	register	std_uint	Total;
+	register	std_uint	Length;
+
+	for (Total = 0; Total < Size * Count; Total += Length)
+		{
+		if (InputStart == InputEnd)
+			{
+			if (InputEnded)
+				break;
+			InputStart = 0;
+			InputEnd = FileManager::GetInstance()->ReadInput(
+				fileno(FileHandle), InputBuffer,
+				INPUT_BUFFER_SIZE, PathName);
+			InputEnded = InputEnd == 0;
+			}
+		Length = InputEnd - InputStart;
+		if (Length > Size * Count - Total)
+			Length = Size * Count - Total;
+		ignore_value(memcpy(Destination + Total, InputBuffer +
+			InputStart, Length));
+		InputStart += Length;
+		}
+	LastOperation = OPERATION_READ;
+	return Size == 0 ? 0: Total / Size;
+	}
+
 ////////////////////////////////////////////////////////////////////////////////
 //! \par	Description:
 //!	Read up to Count items of Size bytes and stores them in Destination.
@@ -587,6 +710,8 @@ INLINE	std_uint	File::Read(void* Destination, std_uint Size,
 
 	assert(FileHandle != static_cast<FILE *>(NULL));
 
+	if (InputBuffer != static_cast<byte *>(NULL))
+		return ReadInput(static_cast<byte *>(Destination), Size, Count);
 	if (LastOperation == OPERATION_WRITE)
 		if (fseek(FileHandle, 0, SEEK_CUR) != FILE_SEEK_OK)
 			throw make_IO_exception(FILE_SEEK_ERROR, PathName);
@@ -744,6 +869,8 @@ INLINE	bool	File::IsEOF(void) throw(FatalException, IOException)
 
 	assert(FileHandle != static_cast<FILE *>(NULL));
 
+	if (InputBuffer != static_cast<byte *>(NULL))
+		return InputEnded;
 	return feof(FileHandle) != FILE_EOF_FALSE;
 	}
 
@@ -958,4 +1085,460 @@ void	File::Unlock(std_uint Size) const throw(FatalException, IOException)
 	FileManager::GetInstance()->Unlock(fileno(FileHandle), Size, PathName);
 	}
 
+////////////////////////////////////////////////////////////////////////////////
+//! \par	Description:
+//!	Lock a given number of bytes, from a given position, without changing
+//!	the current position.
+//!
+//! \param	Offset					Position of the first
+//!							byte to lock.
+//! \param	Size					Number of bytes to lock.
+//!
+//! \throw	utility_space::OUT_OF_MEMORY		If memory allocation
+//!							fails when creating an
+//!							exception.
+//! \throw	io_space::FILE_NOT_OPEN			If the file is not
+//!							opened in write or
+//!							read-write or update
+//!							mode.
+//! \throw	io_space::FILE_DEADLOCK			If the lock would cause
+//!							a deadlock.
+//! \throw	io_space::TOO_MANY_LOCKS		If there are too many
+//!							locks.
+//!
+//! \returns	None
+//!
+//! \note
+//!	If the locked part overlaps a part that has been locked by another
+//!	process, the function waits for the other process to unlock the part.
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+INLINE	void	File::LockAt(std_ulong Offset, std_uint Size) const
+			throw(FatalException, IOException)
+	{
+	switch (Mode)
+		{
+		case OPEN_WRITE:
+		case OPEN_READ_WRITE:
+		case OPEN_UPDATE:
+			break;
+		default:
+			throw make_IO_exception(FILE_NOT_OPEN, PathName);
+		}
+	FileManager::GetInstance()->LockAt(fileno(FileHandle), Offset, Size,
+		PathName);
+	}
+
+////////////////////////////////////////////////////////////////////////////////
+//! \par	Description:
+//!	Unlock a given number of bytes, from a given position, without changing
+//!	the current position.
+//!
+//! \param	Offset					Position of the first
+//!							byte to unlock.
+//! \param	Size					Number of bytes to
+//!							unlock.
+//!
+//! \throw	utility_space::OUT_OF_MEMORY		If memory allocation
+//!							fails when creating an
+//!							exception.
+//! \throw	io_space::FILE_NOT_OPEN			If the file is not
+//!							opened in write or
+//!							read-write or update
+//!							mode.
+//!
+//! \returns	None
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+INLINE	void	File::UnlockAt(std_ulong Offset, std_uint Size) const
+			throw(FatalException, IOException)
+	{
+	switch (Mode)
+		{
+		case OPEN_WRITE:
+		case OPEN_READ_WRITE:
+		case OPEN_UPDATE:
+			break;
+		default:
+			throw make_IO_exception(FILE_NOT_OPEN, PathName);
+		}
+	FileManager::GetInstance()->UnlockAt(fileno(FileHandle), Offset, Size,
+		PathName);
+	}
+
+////////////////////////////////////////////////////////////////////////////////
+//! \par	Description:
+//!	Change the length of the file, without changing the current position.
+//!
+//! \param	Size					New length of the file.
+//!
+//! \throw	utility_space::OUT_OF_MEMORY		If memory allocation
+//!							fails when creating an
+//!							exception.
+//! \throw	io_space::FILE_NOT_OPEN			If the file is not
+//!							opened in write or
+//!							read-write or update
+//!							mode.
+//! \throw	io_space::FILE_WRITE_ERROR		If an error occurs while
+//!							writing.
+//!
+//! \returns	None
+//!
+//! \note
+//!	The user-space buffers are flushed before, so that pending writes do not
+//!	extend the file again later.
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+INLINE	void	File::Truncate(std_ulong Size) throw(FatalException, IOException)
+	{
+	switch (Mode)
+		{
+		case OPEN_WRITE:
+		case OPEN_READ_WRITE:
+		case OPEN_UPDATE:
+			break;
+		case OPEN_READ:
+			throw make_IO_exception(FILE_NOT_OPEN, PathName);
+		default:
+			throw make_IO_exception(FILE_NOT_OPEN, NoPathName);
+		}
+
+	assert(FileHandle != static_cast<FILE *>(NULL));
+
+	ignore_value(fflush(FileHandle));
+	LastOperation = OPERATION_NONE;
+	FileManager::GetInstance()->Truncate(fileno(FileHandle), Size,
+		PathName);
+	}
+
+////////////////////////////////////////////////////////////////////////////////
+//! \par	Description:
+//!	Read a given number of bytes from a given position, bypassing the
+//!	user-space buffers, without changing the current position.
+//!
+//! \param	Destination				Pointer to the buffer
+//!							that upon return will
+//!							contain the bytes read.
+//! \param	Size					Number of bytes to read.
+//! \param	Offset					Position of the first
+//!							byte to read.
+//!
+//! \throw	utility_space::OUT_OF_MEMORY		If memory allocation
+//!							fails when creating an
+//!							exception.
+//! \throw	io_space::FILE_NOT_OPEN			If the file is not
+//!							opened in read or
+//!							read-write or update
+//!							mode.
+//! \throw	io_space::FILE_READ_ERROR		If an error occurs while
+//!							reading.
+//!
+//! \returns	std_uint				The number of bytes
+//!							read, less than Size
+//!							only if the end of file
+//!							is reached.
+//!
+//! \note
+//!	The user-space buffers are flushed before reading, so that pending
+//!	writes are read and buffered data are not used afterwards.
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+INLINE	std_uint	File::ReadAt(void* Destination, std_uint Size,
+				std_ulong Offset) throw(FatalException, IOException)
+	{
+	switch (Mode)
+		{
+		case OPEN_READ:
+		case OPEN_READ_WRITE:
+		case OPEN_UPDATE:
+			break;
+		case OPEN_WRITE:
+			throw make_IO_exception(FILE_NOT_OPEN, PathName);
+		default:
+			throw make_IO_exception(FILE_NOT_OPEN, NoPathName);
+		}
+
+	assert(FileHandle != static_cast<FILE *>(NULL));
+
+	ignore_value(fflush(FileHandle));
+	LastOperation = OPERATION_NONE;
+	return FileManager::GetInstance()->ReadAt(fileno(FileHandle),
+		Destination, Size, Offset, PathName);
+	}
+
+////////////////////////////////////////////////////////////////////////////////
+//! \par	Description:
+//!	Write a given number of bytes from a given position, bypassing the
+//!	user-space buffers, without changing the current position.
+//!
+//! \param	Source					Pointer to the bytes to
+//!							write.
+//! \param	Size					Number of bytes to
+//!							write.
+//! \param	Offset					Position of the first
+//!							byte to write.
+//!
+//! \throw	utility_space::OUT_OF_MEMORY		If memory allocation
+//!							fails when creating an
+//!							exception.
+//! \throw	io_space::FILE_NOT_OPEN			If the file is not
+//!							opened in write or
+//!							read-write or update
+//!							mode.
+//! \throw	io_space::FILE_WRITE_ERROR		If an error occurs while
+//!							writing.
+//!
+//! \returns	None
+//!
+//! \note
+//!	The user-space buffers are flushed before writing, so that pending
+//!	writes do not overwrite the written bytes later and buffered data are
+//!	not used afterwards.
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+INLINE	void	File::WriteAt(const void* Source, std_uint Size,
+			std_ulong Offset) throw(FatalException, IOException)
+	{
+	switch (Mode)
+		{
+		case OPEN_WRITE:
+		case OPEN_READ_WRITE:
+		case OPEN_UPDATE:
+			break;
+		case OPEN_READ:
+			throw make_IO_exception(FILE_NOT_OPEN, PathName);
+		default:
+			throw make_IO_exception(FILE_NOT_OPEN, NoPathName);
+		}
+
+	assert(FileHandle != static_cast<FILE *>(NULL));
+
+	ignore_value(fflush(FileHandle));
+	LastOperation = OPERATION_NONE;
+	FileManager::GetInstance()->WriteAt(fileno(FileHandle), Source, Size,
+		Offset, PathName);
+	}
+
+////////////////////////////////////////////////////////////////////////////////
+//! \par	Description:
+//!	Check whether batches of transfers are performed asynchronously, so
+//!	that submitting many transfers together is faster than performing them
+//!	one at a time.
+//!
+//! \throw	utility_space::OUT_OF_MEMORY		If memory allocation
+//!							fails.
+//!
+//! \returns	bool					true if batches are
+//!							performed
+//!							asynchronously.
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+INLINE	bool	File::IsBatchAsynchronous(void) const throw(FatalException)
+	{
+	return FileManager::GetInstance()->IsBatchAsynchronous();
+	}
+
+////////////////////////////////////////////////////////////////////////////////
+//! \par	Description:
+//!	Read a batch of transfers from given positions, bypassing the
+//!	user-space buffers, without changing the current position.
+//!
+//! \param	Transfers				Array of the transfers.
+//! \param	Count					Number of transfers.
+//!
+//! \throw	utility_space::OUT_OF_MEMORY		If memory allocation
+//!							fails when creating an
+//!							exception.
+//! \throw	io_space::FILE_NOT_OPEN			If the file is not
+//!							opened in read or
+//!							read-write or update
+//!							mode.
+//! \throw	io_space::FILE_READ_ERROR		If an error occurs while
+//!							reading or the end of
+//!							file is reached.
+//!
+//! \returns	None
+//!
+//! \note
+//!	The user-space buffers are flushed before reading, as in ReadAt.
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+INLINE	void	File::ReadBatch(const BatchTransfer* Transfers, std_uint Count)
+			throw(FatalException, IOException)
+	{
+	switch (Mode)
+		{
+		case OPEN_READ:
+		case OPEN_READ_WRITE:
+		case OPEN_UPDATE:
+			break;
+		case OPEN_WRITE:
+			throw make_IO_exception(FILE_NOT_OPEN, PathName);
+		default:
+			throw make_IO_exception(FILE_NOT_OPEN, NoPathName);
+		}
+
+	assert(FileHandle != static_cast<FILE *>(NULL));
+
+	ignore_value(fflush(FileHandle));
+	LastOperation = OPERATION_NONE;
+	FileManager::GetInstance()->ReadBatch(fileno(FileHandle), Transfers,
+		Count, PathName);
+	}
+
+////////////////////////////////////////////////////////////////////////////////
+//! \par	Description:
+//!	Write a batch of transfers at given positions, bypassing the user-space
+//!	buffers, without changing the current position.
+//!
+//! \param	Transfers				Array of the transfers.
+//! \param	Count					Number of transfers.
+//!
+//! \throw	utility_space::OUT_OF_MEMORY		If memory allocation
+//!							fails when creating an
+//!							exception.
+//! \throw	io_space::FILE_NOT_OPEN			If the file is not
+//!							opened in write or
+//!							read-write or update
+//!							mode.
+//! \throw	io_space::FILE_WRITE_ERROR		If an error occurs while
+//!							writing.
+//!
+//! \returns	None
+//!
+//! \note
+//!	The user-space buffers are flushed before writing, as in WriteAt.
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+INLINE	void	File::WriteBatch(const BatchTransfer* Transfers, std_uint Count)
+			throw(FatalException, IOException)
+	{
+	switch (Mode)
+		{
+		case OPEN_WRITE:
+		case OPEN_READ_WRITE:
+		case OPEN_UPDATE:
+			break;
+		case OPEN_READ:
+			throw make_IO_exception(FILE_NOT_OPEN, PathName);
+		default:
+			throw make_IO_exception(FILE_NOT_OPEN, NoPathName);
+		}
+
+	assert(FileHandle != static_cast<FILE *>(NULL));
+
+	ignore_value(fflush(FileHandle));
+	LastOperation = OPERATION_NONE;
+	FileManager::GetInstance()->WriteBatch(fileno(FileHandle), Transfers,
+		Count, PathName);
+	}
+
+////////////////////////////////////////////////////////////////////////////////
+//! \par	Description:
+//!	Map the first bytes of the file in memory, shared with the other
+//!	processes; the bytes can be modified only if the file has been opened
+//!	in read-write or update mode.
+//!
+//! \param	Size					Number of bytes to map.
+//!
+//! \throw	utility_space::OUT_OF_MEMORY		If memory allocation
+//!							fails when creating an
+//!							exception.
+//! \throw	io_space::FILE_NOT_OPEN			If the file is not
+//!							opened in read or
+//!							read-write or update
+//!							mode.
+//! \throw	io_space::FILE_INVALID_PATH_NAME	If the file cannot be
+//!							mapped or Size is 0.
+//! \throw	io_space::FILE_IO_ERROR			If there is not enough
+//!							address space.
+//!
+//! \returns	void*					The address of the first
+//!							mapped byte.
+//!
+//! \note
+//!	The user-space buffers are flushed before mapping, so that pending
+//!	writes are mapped; the mapping remains valid after closing the file,
+//!	until Unmap is called.
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+INLINE	void*	File::Map(std_ulong Size) throw(FatalException, IOException)
+	{
+	switch (Mode)
+		{
+		case OPEN_READ:
+		case OPEN_READ_WRITE:
+		case OPEN_UPDATE:
+			break;
+		case OPEN_WRITE:
+			throw make_IO_exception(FILE_NOT_OPEN, PathName);
+		default:
+			throw make_IO_exception(FILE_NOT_OPEN, NoPathName);
+		}
+
+	assert(FileHandle != static_cast<FILE *>(NULL));
+
+	ignore_value(fflush(FileHandle));
+	LastOperation = OPERATION_NONE;
+	return FileManager::GetInstance()->Map(fileno(FileHandle), Size,
+		Mode != OPEN_READ, PathName);
+	}
+
+////////////////////////////////////////////////////////////////////////////////
+//! \par	Description:
+//!	Remove a mapping created by Map.
+//!
+//! \param	Address					Address returned by Map.
+//! \param	Size					Number of bytes mapped.
+//!
+//! \throw	utility_space::OUT_OF_MEMORY		If memory allocation
+//!							fails when creating an
+//!							exception.
+//! \throw	utility_space::ILLEGAL_ARGUMENT		If the arguments do not
+//!							correspond to a mapping.
+//!
+//! \returns	None
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+INLINE	void	File::Unmap(void* Address, std_ulong Size) const
+			throw(FatalException)
+	{
+	FileManager::GetInstance()->Unmap(Address, Size);
+	}
+
+////////////////////////////////////////////////////////////////////////////////
+//! \par	Description:
+//!	Write the changed bytes of a part of a mapping to the disk.
+//!
+//! \param	Address					Address of the first
+//!							byte to write.
+//! \param	Size					Number of bytes to
+//!							write.
+//!
+//! \throw	utility_space::OUT_OF_MEMORY		If memory allocation
+//!							fails when creating an
+//!							exception.
+//! \throw	io_space::FILE_WRITE_ERROR		If an error occurs while
+//!							writing.
+//!
+//! \returns	None
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+INLINE	void	File::SynchronizeMap(const void* Address, std_ulong Size) const
+			throw(FatalException, IOException)
+	{
+	FileManager::GetInstance()->SynchronizeMap(Address, Size, PathName);
+	}
+
 }
@@ -26,12 +26,44 @@
 //!	Valure returned by remove when the operation succeeds.
 # define	FILE_REMOVE_OK			0
 
+//! \def	NO_WATCH
+//!	Value returned by WatchFile when the system cannot notify the changes
+//!	to the files.
+# define	NO_WATCH			(-1)
+
+//! \def	WAIT_FOREVER
+//!	Timeout of WaitForChanges meaning that the function waits for a change
+//!	without a time limit.
+# define	WAIT_FOREVER			STD_UINT_MAX
+
 namespace	io_space
 {
 
 using	namespace	utility_space;
 using	namespace	data_structure_space;
 
+////////////////////////////////////////////////////////////////////////////////
+//! \struct	BatchTransfer
+//!	The BatchTransfer struct describes a transfer between a buffer and a
+//!	given position of a file, as part of a batch.
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+struct	BatchTransfer
+	{
+//! \property	Buffer
+//!	Pointer to the buffer.
+	void*		Buffer;
+
+//! \property	Size
+//!	Number of bytes to transfer.
+	std_uint	Size;
+
+//! \property	Offset
+//!	Position of the first byte in the file.
+	std_ulong	Offset;
+	};
+
 ////////////////////////////////////////////////////////////////////////////////
 //! \class	FileManager
 //!	Abstract class, which declares all the basic file system related
@@ -188,6 +220,129 @@ class	FileManager
 							IOException) =
 							PURE_VIRTUAL;
 
+		virtual		void		LockAt(int FileDescriptor,
+							std_ulong Offset,
+							std_uint Size,
+							const CharString&
+							PathName) const
+							throw(FatalException,
+							IOException) =
+							PURE_VIRTUAL;
+
+		virtual		void		UnlockAt(int FileDescriptor,
+							std_ulong Offset,
+							std_uint Size,
+							const CharString&
+							PathName) const
+							throw(FatalException,
+							IOException) =
+							PURE_VIRTUAL;
+
+		virtual		void		Truncate(int FileDescriptor,
+							std_ulong Size,
+							const CharString&
+							PathName) const
+							throw(FatalException,
+							IOException) =
+							PURE_VIRTUAL;
+
+		virtual		std_uint	ReadAt(int FileDescriptor,
+							void* Destination,
+							std_uint Size,
+							std_ulong Offset,
+							const CharString&
+							PathName) const
+							throw(FatalException,
+							IOException) =
+							PURE_VIRTUAL;
+
+		virtual		void		WriteAt(int FileDescriptor,
+							const void* Source,
+							std_uint Size,
+							std_ulong Offset,
+							const CharString&
+							PathName) const
+							throw(FatalException,
+							IOException) =
+							PURE_VIRTUAL;
+
+		virtual		bool		IsBatchAsynchronous(void) const
+							noexcept;
+
+		virtual		void		ReadBatch(int FileDescriptor,
+							const BatchTransfer*
+							Transfers,
+							std_uint Count,
+							const CharString&
+							PathName) const
+							throw(FatalException,
+							IOException);
+
+		virtual		void		WriteBatch(int FileDescriptor,
+							const BatchTransfer*
+							Transfers,
+							std_uint Count,
+							const CharString&
+							PathName) const
+							throw(FatalException,
+							IOException);
+
+		virtual		void*		Map(int FileDescriptor,
+							std_ulong Size,
+							bool Writable,
+							const CharString&
+							PathName) const
+							throw(FatalException,
+							IOException) =
+							PURE_VIRTUAL;
+
+		virtual		void		Unmap(void* Address,
+							std_ulong Size) const
+							throw(FatalException) =
+							PURE_VIRTUAL;
+
+		virtual		void		SynchronizeMap(const void*
+							Address, std_ulong Size,
+							const CharString&
+							PathName) const
+							throw(FatalException,
+							IOException) =
+							PURE_VIRTUAL;
+
+		virtual		std_uint	ReadInput(int FileDescriptor,
+							void* Destination,
+							std_uint Size,
+							const CharString&
+							PathName) const
+							throw(FatalException,
+							IOException) =
+							PURE_VIRTUAL;
+
+		virtual		bool		IsInputReady(int FileDescriptor,
+							std_uint Timeout,
+							const CharString&
+							PathName) const
+							throw(FatalException,
+							IOException);
+
+		virtual		int		WatchFile(const CharString&
+							PathName) const
+							throw(FatalException,
+							IOException);
+
+		virtual		bool		WaitForChanges(int Watch,
+							std_uint Timeout,
+							const CharString&
+							PathName) const
+							throw(FatalException,
+							IOException);
+
+		virtual		void		CloseWatch(int Watch,
+							const CharString&
+							PathName) const
+							throw(FatalException,
+							IOException);
+
 		virtual		IOErrorType	MakeExceptionKind(int Error)
 							const
 							throw(FatalException) =
@@ -20,6 +20,10 @@
 # include	"GenericString.h"
 # include	"FileManager.h"
 
+# if	defined USE_IO_URING
+# include	<linux/io_uring.h>
+# endif
+
 //! \def	LINUX_DIRECTORY_SEPARATOR
 //!	Linux directory separator.
 # define	LINUX_DIRECTORY_SEPARATOR	"/"
@@ -36,6 +40,19 @@
 //!	Linux parent directory name.
 # define	LINUX_PARENT_DIRECTORY_NAME	".."
 
+//! \def	RING_ENTRIES
+//!	Number of entries of the io_uring submission queue; larger batches are
+//!	submitted in parts.
+# define	RING_ENTRIES			256
+
+//! \def	RING_NOT_STARTED
+//!	Value of RingDescriptor before the io_uring instance is created.
+# define	RING_NOT_STARTED		(-2)
+
+//! \def	RING_UNAVAILABLE
+//!	Value of RingDescriptor when the io_uring instance cannot be created.
+# define	RING_UNAVAILABLE		(-1)
+
 namespace	io_space
 {
 
@@ -59,6 +76,39 @@ class	LinuxFileManager: public FileManager
 
 	private:
 
+# if	defined USE_IO_URING
+//! \property	RingDescriptor
+//!	File descriptor of the io_uring instance used for batches of transfers,
+//!	RING_NOT_STARTED or RING_UNAVAILABLE.
+		mutable	int			RingDescriptor;
+
+//! \property	RingParameters
+//!	Parameters of the io_uring instance, including the offsets of the fields
+//!	of the rings.
+		mutable	io_uring_params		RingParameters;
+
+//! \property	SubmissionRing
+//!	Address of the mapped submission ring.
+		mutable	byte*			SubmissionRing;
+
+//! \property	SubmissionRingSize
+//!	Size of the mapped submission ring.
+		mutable	std_ulong		SubmissionRingSize;
+
+//! \property	CompletionRing
+//!	Address of the mapped completion ring; it can be the same as
+//!	SubmissionRing.
+		mutable	byte*			CompletionRing;
+
+//! \property	CompletionRingSize
+//!	Size of the mapped completion ring.
+		mutable	std_ulong		CompletionRingSize;
+
+//! \property	SubmissionEntries
+//!	Address of the mapped array of submission entries.
+		mutable	io_uring_sqe*		SubmissionEntries;
+# endif
+
 						LinuxFileManager(void)
 							throw(FatalException);
 
@@ -81,8 +131,24 @@ class	LinuxFileManager: public FileManager
 							thisFileManager)
 							noexcept = delete;
 
+# if	defined USE_IO_URING
+			bool		StartRing(void) const noexcept;
+
+			void		StopRing(void) const noexcept;
+
+			bool		TransferBatch(int FileDescriptor,
+						const BatchTransfer* Transfers,
+						std_uint Count, bool Write,
+						const CharString& PathName)
+						const throw(FatalException,
+						IOException);
+# endif
+
 	public:
 
+						~LinuxFileManager(void)
+							noexcept;
+
 			bool		IsDirectory(const CharString& PathName)
 						const throw(FatalException,
 						IOException);
@@ -127,6 +193,98 @@ class	LinuxFileManager: public FileManager
 						const throw(FatalException,
 						IOException);
 
+			void		LockAt(int FileDescriptor,
+						std_ulong Offset, std_uint Size,
+						const CharString& PathName)
+						const throw(FatalException,
+						IOException);
+
+			void		UnlockAt(int FileDescriptor,
+						std_ulong Offset, std_uint Size,
+						const CharString& PathName)
+						const throw(FatalException,
+						IOException);
+
+			void		Truncate(int FileDescriptor,
+						std_ulong Size,
+						const CharString& PathName)
+						const throw(FatalException,
+						IOException);
+
+			std_uint	ReadAt(int FileDescriptor,
+						void* Destination,
+						std_uint Size, std_ulong Offset,
+						const CharString& PathName)
+						const throw(FatalException,
+						IOException);
+
+			void		WriteAt(int FileDescriptor,
+						const void* Source,
+						std_uint Size, std_ulong Offset,
+						const CharString& PathName)
+						const throw(FatalException,
+						IOException);
+
+			bool		IsBatchAsynchronous(void) const
+						noexcept;
+
+			void		ReadBatch(int FileDescriptor,
+						const BatchTransfer* Transfers,
+						std_uint Count,
+						const CharString& PathName)
+						const throw(FatalException,
+						IOException);
+
+			void		WriteBatch(int FileDescriptor,
+						const BatchTransfer* Transfers,
+						std_uint Count,
+						const CharString& PathName)
+						const throw(FatalException,
+						IOException);
+
+			void*		Map(int FileDescriptor, std_ulong Size,
+						bool Writable,
+						const CharString& PathName)
+						const throw(FatalException,
+						IOException);
+
+			void		Unmap(void* Address, std_ulong Size)
+						const throw(FatalException);
+
+			void		SynchronizeMap(const void* Address,
+						std_ulong Size,
+						const CharString& PathName)
+						const throw(FatalException,
+						IOException);
+
+			std_uint	ReadInput(int FileDescriptor,
+						void* Destination,
+						std_uint Size,
+						const CharString& PathName)
+						const throw(FatalException,
+						IOException);
+
+			bool		IsInputReady(int FileDescriptor,
+						std_uint Timeout,
+						const CharString& PathName)
+						const throw(FatalException,
+						IOException);
+
+			int		WatchFile(const CharString& PathName)
+						const throw(FatalException,
+						IOException);
+
+			bool		WaitForChanges(int Watch,
+						std_uint Timeout,
+						const CharString& PathName)
+						const throw(FatalException,
+						IOException);
+
+			void		CloseWatch(int Watch,
+						const CharString& PathName)
+						const throw(FatalException,
+						IOException);
+
 			IOErrorType	MakeExceptionKind(int Error) const
 						throw(FatalException);
 
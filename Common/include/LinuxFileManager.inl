@@ -38,6 +38,12 @@ using	namespace	data_structure_space;
 			CharString(LINUX_EXTENSION_SEPARATOR),
 			CharString(LINUX_CURRENT_DIRECTORY_NAME),
 			CharString(LINUX_PARENT_DIRECTORY_NAME))
+# if	defined USE_IO_URING
+			, RingDescriptor(RING_NOT_STARTED), RingParameters(),
+			SubmissionRing(nullptr), SubmissionRingSize(0),
+			CompletionRing(nullptr), CompletionRingSize(0),
+			SubmissionEntries(nullptr)
+# endif
 		{
 		}
 
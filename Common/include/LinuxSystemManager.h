@@ -69,6 +69,17 @@ class	LinuxSystemManager: public SystemManager
 		virtual void		Sleep(std_uint SleepTime) const
 						noexcept;
 
+		virtual	bool		InitializeSharedLock(void* Lock) const
+						noexcept;
+
+		virtual	bool		AcquireSharedLock(void* Lock) const
+						noexcept;
+
+		virtual	void		ReleaseSharedLock(void* Lock) const
+						noexcept;
+
+		virtual	std_ulong	GetBootIdentifier(void) const noexcept;
+
 	};
 
 }
@@ -0,0 +1,188 @@
+////////////////////////////////////////////////////////////////////////////////
+//! \file
+//!
+//! \author	agent
+//!
+//! \date	16/10/2026
+//!
+//! \par	Function:
+//!	Contains the declaration of the data_structure_space::Set class
+//!	template.
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+# if	!defined SET_H
+
+# define	SET_H
+
+# include	"FatalException.h"
+# include	"Vector.h"
+
+namespace	data_structure_space
+{
+
+using	namespace	utility_space;
+
+//! \def	DEFAULT_SET_SIZE
+//!	Default number of elements a Set can contain without growing.
+# define	DEFAULT_SET_SIZE			32
+
+//! \def	SET_HASH_MULTIPLIER
+//!	Multiplier used by the default hash function: the 64 bits fraction of
+//!	the golden ratio.
+# define	SET_HASH_MULTIPLIER			0x9E3779B97F4A7C15ULL
+
+////////////////////////////////////////////////////////////////////////////////
+//! \class	Set
+//!	The Set class template represents a growable set of distinct objects,
+//!	stored in an open addressing hash table with linear probing. \n
+//!	The elements can be accessed using an integer index, in the order they
+//!	have been inserted.
+//!
+//! \tparam	ELEMENT_TYPE	Class of the elements; it can be any class or
+//!				built-in type, which has the following
+//!				accessible methods (either by default or
+//!				explicitly declared):
+//!				- constructor without arguments,
+//!				- destructor,
+//!				- assignment operator,
+//!				- new [] operator,
+//!				- delete [] operator,
+//!				- == comparison operator.
+//!				.
+//!				The constructor, assignment operator and new []
+//!				operator can throw an
+//!				utility_space::OUT_OF_MEMORY FatalException;
+//!				other methods in the above list shall not throw
+//!				any exception.
+//!
+//! \note
+//!	The hash function is by default a multiplicative hash of the value
+//!	converted to std_ulong, unless a hash function, with a constant
+//!	reference to ELEMENT_TYPE as argument and returning a std_uint value, is
+//!	provided during object creation, in which case the conversion is not
+//!	used and it does not need to be defined.
+//!
+//! \note
+//!	Each slot of the table contains the element together with the
+//!	generation it belongs to, so that a lookup reads a single slot per probe
+//!	and Clear takes constant time, without touching the table. \n
+//!	The table is never filled beyond one half, so that the probe sequences
+//!	stay short; it doubles when needed and it never shrinks, so that no
+//!	memory is allocated once it has grown to the largest number of elements.
+//!
+//! \see	DEFAULT_SET_SIZE
+//! \see	SET_HASH_MULTIPLIER
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+template<class ELEMENT_TYPE>
+	class	Set
+	{
+	private:
+
+//! \typedef	HashFunctionType
+//!	Pointer to a function used to compute the hash of values in a Set.
+//!
+//! \note
+//!	The pointed to function Hash must return a value that depends uniquely
+//!	upon its argument, and equal values must have the same hash; if these
+//!	requirements are not satisfied, the behaviour and the content of the Set
+//!	object are unpredictable.
+		typedef	std_uint	(*HashFunctionType)(const ELEMENT_TYPE&
+						Element);
+
+////////////////////////////////////////////////////////////////////////////////
+//! \struct	SlotType
+//!	The SlotType struct contains a slot of the hash table.
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+		struct	SlotType
+			{
+//! \property	Generation
+//!	Generation of the element, or 0 if the slot has never been used; the
+//!	slot is free if it differs from the generation of the Set.
+			std_uint	Generation;
+
+//! \property	Element
+//!	Element stored in the slot.
+			ELEMENT_TYPE	Element;
+			};
+
+//! \property Hash
+//!	Pointer to the hash function. \n
+//!	Is is never changed after object creation.
+			HashFunctionType	Hash;
+
+//! \property Elements
+//!	Vector containing the elements, in insertion order.
+			Vector<ELEMENT_TYPE>	Elements;
+
+//! \property Slots
+//!	Vector containing the slots of the hash table; the number of slots is a
+//!	power of 2.
+			Vector<SlotType>	Slots;
+
+//! \property Mask
+//!	Number of slots minus 1.
+			std_uint		Mask;
+
+//! \property Generation
+//!	Generation of the elements currently in the Set; it is incremented by
+//!	Clear and it is never 0.
+			std_uint		Generation;
+
+			std_uint	FindSlot(register const ELEMENT_TYPE&
+						Element) const noexcept;
+
+			void		Rehash(std_uint NumSlots)
+						throw(FatalException);
+
+		static	std_uint	ComputeSlots(std_uint thisSize)
+						noexcept;
+
+		static	std_uint	DefaultHash(const ELEMENT_TYPE& Element)
+						noexcept;
+
+	public:
+
+					Set(void) throw(FatalException);
+
+			explicit	Set(HashFunctionType thisHash)
+						throw(FatalException);
+
+			explicit	Set(std_uint thisSize)
+						throw(FatalException);
+
+					Set(std_uint thisSize,
+						HashFunctionType thisHash)
+						throw(FatalException);
+
+					~Set(void) noexcept;
+
+		const	ELEMENT_TYPE&	operator [] (std_uint Index) const
+						throw(FatalException);
+
+			std_uint	GetPresent(void) const noexcept;
+
+			bool		IsEmpty(void) const noexcept;
+
+		const	Vector<ELEMENT_TYPE>&	GetElements(void) const
+						noexcept;
+
+			bool		Contains(const ELEMENT_TYPE& Element)
+						const noexcept;
+
+			bool		Insert(const ELEMENT_TYPE& Element)
+						throw(FatalException);
+
+			void		Clear(void) noexcept;
+
+	};
+
+}
+
+# include	"Set.tpl"
+
+# endif
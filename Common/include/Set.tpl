@@ -0,0 +1,422 @@
+////////////////////////////////////////////////////////////////////////////////
+//! \file
+//!
+//! \author	agent
+//!
+//! \date	16/10/2026
+//!
+//! \par	Function:
+//!	Contains the implementation of the data_structure_space::Set class
+//!	template.
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+namespace	data_structure_space
+{
+
+using	namespace	utility_space;
+
+////////////////////////////////////////////////////////////////////////////////
+//! \par	Description:
+//!	Find the slot containing an element, or the free slot where it should be
+//!	inserted if it is not present.
+//!
+//! \param	Element		Reference to the element.
+//!
+//! \throw	None.
+//!
+//! \returns	std_uint	The index of the slot.
+//!
+//! \note
+//!	The table always contains free slots, so that the search terminates.
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+template<class ELEMENT_TYPE>
+	INLINE	std_uint	Set<ELEMENT_TYPE>::FindSlot(register const
+					ELEMENT_TYPE& Element) const noexcept
+		{
+		register	const	SlotType*	Store;
+		register		std_uint	Slot;
+
+		Store = Slots.GetStore();
+		for (Slot = Hash(Element) & Mask;
+			Store [Slot].Generation == Generation and
+			not (Store [Slot].Element == Element);
+			Slot = (Slot + 1) & Mask)
+			;
+		return Slot;
+		}
+
+////////////////////////////////////////////////////////////////////////////////
+//! \par	Description:
+//!	Rebuild the hash table with a given number of slots, inserting again
+//!	all the elements.
+//!
+//! \param	NumSlots			Number of slots; it must be a
+//!						power of 2 greater than twice
+//!						the number of elements.
+//!
+//! \throw	utility_space::OUT_OF_MEMORY	If memory allocation fails.
+//!
+//! \returns	None.
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+template<class ELEMENT_TYPE>
+	void	Set<ELEMENT_TYPE>::Rehash(std_uint NumSlots)
+			throw(FatalException)
+		{
+		register	std_uint	Index;
+		register	std_uint	Slot;
+				SlotType	FreeSlot;
+
+		assert((NumSlots & (NumSlots - 1)) == 0);
+		assert(NumSlots > 2 * Elements.GetPresent());
+
+		FreeSlot.Generation = 0;
+		Slots.Clear();
+		Slots.Append(FreeSlot, NumSlots);
+		Mask = NumSlots - 1;
+		Generation = 1;
+		for (Index = 0; Index < Elements.GetPresent(); ++Index)
+			{
+			Slot = FindSlot(Elements.GetStore() [Index]);
+			Slots.GetStore() [Slot].Generation = Generation;
+			Slots.GetStore() [Slot].Element =
+				Elements.GetStore() [Index];
+			}
+		}
+
+////////////////////////////////////////////////////////////////////////////////
+//! \par	Description:
+//!	Compute the number of slots of the hash table needed for a given
+//!	number of elements.
+//!
+//! \param	thisSize	The number of elements.
+//!
+//! \throw	None.
+//!
+//! \returns	std_uint	The smallest power of 2 greater than twice the
+//!				number of elements.
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+template<class ELEMENT_TYPE>
+	INLINE	std_uint	Set<ELEMENT_TYPE>::ComputeSlots(std_uint
+					thisSize) noexcept
+		{
+		register	std_uint	NumSlots;
+
+		assert(thisSize < STD_UINT_MAX / 4);
+
+		for (NumSlots = 1; NumSlots <= 2 * thisSize; NumSlots *= 2)
+			;
+		return NumSlots;
+		}
+
+////////////////////////////////////////////////////////////////////////////////
+//! \par	Description:
+//!	Default hash function: the high half of the product of the value by
+//!	SET_HASH_MULTIPLIER.
+//!
+//! \param	Element		Reference to the element.
+//!
+//! \throw	None.
+//!
+//! \returns	std_uint	The hash of the element.
+//!
+//! \see	SET_HASH_MULTIPLIER
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+template<class ELEMENT_TYPE>
+	INLINE	std_uint	Set<ELEMENT_TYPE>::DefaultHash(const
+					ELEMENT_TYPE& Element) noexcept
+		{
+		return static_cast<std_uint>((static_cast<std_ulong>(Element) *
+			SET_HASH_MULTIPLIER) >> (STD_ULONG_BITS / 2));
+		}
+
+////////////////////////////////////////////////////////////////////////////////
+//! \par	Description:
+//!	Default constructor; construct an empty Set object with default size
+//!	and default hash function.
+//!
+//! \throw	utility_space::OUT_OF_MEMORY	If memory allocation fails.
+//!
+//! \returns	Not applicable.
+//!
+//! \see	DEFAULT_SET_SIZE
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+template<class ELEMENT_TYPE>
+	INLINE	Set<ELEMENT_TYPE>::Set(void) throw(FatalException):
+			Hash(DefaultHash), Elements(DEFAULT_SET_SIZE), Slots(),
+			Mask(0), Generation(0)
+		{
+		Rehash(ComputeSlots(DEFAULT_SET_SIZE));
+		}
+
+////////////////////////////////////////////////////////////////////////////////
+//! \par	Description:
+//!	Single argument constructor; construct an empty Set object with default
+//!	size and given hash function.
+//!
+//! \param	thisHash			Hash function.
+//!
+//! \throw	utility_space::OUT_OF_MEMORY	If memory allocation fails.
+//! \throw	utility_space::ILLEGAL_ARGUMENT	If the pointer to the hash
+//!						function is NULL.
+//!
+//! \returns	Not applicable.
+//!
+//! \see	DEFAULT_SET_SIZE
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+template<class ELEMENT_TYPE>
+	INLINE	Set<ELEMENT_TYPE>::Set(HashFunctionType thisHash)
+			throw(FatalException): Hash(thisHash),
+			Elements(DEFAULT_SET_SIZE), Slots(), Mask(0),
+			Generation(0)
+		{
+		if (thisHash == static_cast<HashFunctionType>(NULL))
+			throw make_fatal_exception(ILLEGAL_ARGUMENT);
+		Rehash(ComputeSlots(DEFAULT_SET_SIZE));
+		}
+
+////////////////////////////////////////////////////////////////////////////////
+//! \par	Description:
+//!	Single argument constructor; construct an empty Set object that can
+//!	contain the number of elements passed as argument without growing, with
+//!	default hash function.
+//!
+//! \param	thisSize			Number of elements.
+//!
+//! \throw	utility_space::OUT_OF_MEMORY	If memory allocation fails.
+//!
+//! \returns	Not applicable.
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+template<class ELEMENT_TYPE>
+	INLINE	Set<ELEMENT_TYPE>::Set(std_uint thisSize)
+			throw(FatalException): Hash(DefaultHash),
+			Elements(thisSize), Slots(), Mask(0), Generation(0)
+		{
+		Rehash(ComputeSlots(thisSize));
+		}
+
+////////////////////////////////////////////////////////////////////////////////
+//! \par	Description:
+//!	Two arguments constructor; construct an empty Set object that can
+//!	contain the number of elements passed as argument without growing, with
+//!	given hash function.
+//!
+//! \param	thisSize			Number of elements.
+//! \param	thisHash			Hash function.
+//!
+//! \throw	utility_space::OUT_OF_MEMORY	If memory allocation fails.
+//! \throw	utility_space::ILLEGAL_ARGUMENT	If the pointer to the hash
+//!						function is NULL.
+//!
+//! \returns	Not applicable.
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+template<class ELEMENT_TYPE>
+	INLINE	Set<ELEMENT_TYPE>::Set(std_uint thisSize,
+			HashFunctionType thisHash) throw(FatalException):
+			Hash(thisHash), Elements(thisSize), Slots(), Mask(0),
+			Generation(0)
+		{
+		if (thisHash == static_cast<HashFunctionType>(NULL))
+			throw make_fatal_exception(ILLEGAL_ARGUMENT);
+		Rehash(ComputeSlots(thisSize));
+		}
+
+////////////////////////////////////////////////////////////////////////////////
+//! \par	Description:
+//!	Destructor.
+//!
+//! \throw	None.
+//!
+//! \returns	Not applicable.
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+template<class ELEMENT_TYPE>
+	INLINE	Set<ELEMENT_TYPE>::~Set(void) noexcept
+		{
+		}
+
+////////////////////////////////////////////////////////////////////////////////
+//! \par	Description:
+//!	Access an element of the Set, in insertion order.
+//!
+//! \param	Index					Index of the element.
+//!							Valid range is
+//!						[0 .. GetPresent() - 1].
+//!
+//! \throw	utility_space::OUT_OF_MEMORY		If memory allocation
+//!							fails when creating an
+//!							exception.
+//! \throw	utility_space::INDEX_OUT_OF_BOUNDS	If the index is outside
+//!							the valid range.
+//!
+//! \returns	const ELEMENT_TYPE&			A reference to the
+//!							element.
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+template<class ELEMENT_TYPE>
+	INLINE	const	ELEMENT_TYPE&	Set<ELEMENT_TYPE>::operator []
+					(std_uint Index) const
+					throw(FatalException)
+		{
+		return Elements [Index];
+		}
+
+////////////////////////////////////////////////////////////////////////////////
+//! \par	Description:
+//!	Get the number of elements in the Set.
+//!
+//! \throw	None.
+//!
+//! \returns	std_uint	The number of elements.
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+template<class ELEMENT_TYPE>
+	INLINE	std_uint	Set<ELEMENT_TYPE>::GetPresent(void) const
+					noexcept
+		{
+		return Elements.GetPresent();
+		}
+
+////////////////////////////////////////////////////////////////////////////////
+//! \par	Description:
+//!	Check whether the Set is empty.
+//!
+//! \throw	None.
+//!
+//! \returns	bool	true if the Set is empty, false otherwise.
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+template<class ELEMENT_TYPE>
+	INLINE	bool	Set<ELEMENT_TYPE>::IsEmpty(void) const noexcept
+		{
+		return Elements.IsEmpty();
+		}
+
+////////////////////////////////////////////////////////////////////////////////
+//! \par	Description:
+//!	Get the elements of the Set, in insertion order.
+//!
+//! \throw	None.
+//!
+//! \returns	const Vector<ELEMENT_TYPE>&	A reference to the Vector
+//!						containing the elements; it is
+//!						valid until the Set is modified.
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+template<class ELEMENT_TYPE>
+	INLINE	const	Vector<ELEMENT_TYPE>&	Set<ELEMENT_TYPE>::GetElements(
+					void) const noexcept
+		{
+		return Elements;
+		}
+
+////////////////////////////////////////////////////////////////////////////////
+//! \par	Description:
+//!	Check whether an element is in the Set.
+//!
+//! \param	Element		Reference to the element.
+//!
+//! \throw	None.
+//!
+//! \returns	bool	true if the element is in the Set, false otherwise.
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+template<class ELEMENT_TYPE>
+	INLINE	bool	Set<ELEMENT_TYPE>::Contains(const ELEMENT_TYPE&
+				Element) const noexcept
+		{
+		return Slots.GetStore() [FindSlot(Element)].Generation ==
+			Generation;
+		}
+
+////////////////////////////////////////////////////////////////////////////////
+//! \par	Description:
+//!	Insert an element into the Set, if it is not already present.
+//!
+//! \param	Element				Reference to the element.
+//!
+//! \throw	utility_space::OUT_OF_MEMORY	If memory allocation fails.
+//!
+//! \returns	bool				true if the element has been
+//!						inserted, false if it was
+//!						already present.
+//!
+//! \note
+//!	The hash table is doubled when it would become more than half full.
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+template<class ELEMENT_TYPE>
+	INLINE	bool	Set<ELEMENT_TYPE>::Insert(const ELEMENT_TYPE& Element)
+				throw(FatalException)
+		{
+		register	std_uint	Slot;
+
+		Slot = FindSlot(Element);
+		if (Slots.GetStore() [Slot].Generation == Generation)
+			return false;
+		Elements.Append(Element);
+		if (2 * Elements.GetPresent() > Mask)
+			{
+			Rehash(2 * (Mask + 1));
+			return true;
+			}
+		Slots.GetStore() [Slot].Generation = Generation;
+		Slots.GetStore() [Slot].Element = Element;
+		return true;
+		}
+
+////////////////////////////////////////////////////////////////////////////////
+//! \par	Description:
+//!	Remove all the elements from the Set, without releasing memory.
+//!
+//! \throw	None.
+//!
+//! \returns	None.
+//!
+//! \note
+//!	The slots are freed by changing the generation of the Set; only when the
+//!	generation wraps around, once every STD_UINT_MAX calls, the whole table
+//!	is reset.
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+template<class ELEMENT_TYPE>
+	INLINE	void	Set<ELEMENT_TYPE>::Clear(void) noexcept
+		{
+		register	SlotType*	Store;
+		register	std_uint	Slot;
+
+		Elements.Clear();
+		if (++Generation == 0)
+			{
+			Store = Slots.GetStore();
+			for (Slot = 0; Slot <= Mask; ++Slot)
+				Store [Slot].Generation = 0;
+			Generation = 1;
+			}
+		}
+
+}
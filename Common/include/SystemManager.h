@@ -43,6 +43,12 @@
 # define	NANOSECONDS_PER_SECOND \
 	(MILLISECONDS_PER_SECOND * NANOSECONDS_PER_MILLISECOND)
 
+//! \def	SHARED_LOCK_SIZE
+//!	Number of bytes reserved for a lock shared among processes; it is a
+//!	multiple of the cache line size, so that adjacent locks do not share a
+//!	cache line.
+# define	SHARED_LOCK_SIZE		64
+
 namespace	system_space
 {
 
@@ -98,6 +104,18 @@ class	SystemManager
 		virtual void		Sleep(std_uint SleepTime) const
 						noexcept = PURE_VIRTUAL;
 
+		virtual	bool		InitializeSharedLock(void* Lock) const
+						noexcept = PURE_VIRTUAL;
+
+		virtual	bool		AcquireSharedLock(void* Lock) const
+						noexcept = PURE_VIRTUAL;
+
+		virtual	void		ReleaseSharedLock(void* Lock) const
+						noexcept = PURE_VIRTUAL;
+
+		virtual	std_ulong	GetBootIdentifier(void) const noexcept =
+						PURE_VIRTUAL;
+
 		static	SystemManager*	GetInstance(void) noexcept;
 
 	};
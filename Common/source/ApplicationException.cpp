@@ -42,6 +42,7 @@ const	char*	const	ApplicationExceptionBase::ExceptionName
 	"the file containing guarantors data has invalid length",
 	"the file containing voters' indices has invalid length",
 	"the file containing votes has invalid length",
+	"the file containing the locks of the records has invalid length",
 	"the voters' key is not correct",
 	"the votes' key is not correct",
 	"the time interval is zero or greater than the maximum valid value",
@@ -64,7 +65,17 @@ const	char*	const	ApplicationExceptionBase::ExceptionName
 	"the signature is missing",
 	"the key of the guarantor has already been set",
 	"the vote of the candidate has already been set",
-	"the format of the encryption file is not valid"
+	"the format of the encryption file is not valid",
+	"the cipher engine of the election is not supported by the processor",
+	"the number of votes between disk synchronizations is zero or greater "
+	"than the maximum valid value",
+	"the number of decoy votes is outside the valid range",
+	"the number of votes modified by each noise iteration is zero or "
+	"greater than the maximum valid value",
+	"the number of votes files is zero or greater than the maximum valid "
+	"value or the number of voters",
+	"the number of threads is zero or greater than the maximum valid value",
+	"the file containing the generations of the votes has invalid length"
 	};
 
 }
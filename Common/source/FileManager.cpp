@@ -118,6 +118,192 @@ void	FileManager::SystemFlush(int FileDescriptor, const CharString& PathName)		c
 	{
 	}
 
+////////////////////////////////////////////////////////////////////////////////
+//! \par	Description:
+//!	Check whether batches of transfers are performed asynchronously, so
+//!	that submitting many transfers together is faster than performing them
+//!	one at a time. \n
+//!	Default implementation for systems without asynchronous transfers.
+//!
+//! \throw	None.
+//!
+//! \returns	bool					Always false.
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+bool	FileManager::IsBatchAsynchronous(void) const noexcept
+	{
+	return false;
+	}
+
+////////////////////////////////////////////////////////////////////////////////
+//! \par	Description:
+//!	Read a batch of transfers from given positions of a file. \n
+//!	Default implementation, performing the transfers one at a time.
+//!
+//! \param	FileDescriptor				File descriptor of the
+//!							file.
+//! \param	Transfers				Array of the transfers.
+//! \param	Count					Number of transfers.
+//! \param	PathName				PathName of the file.
+//!
+//! \throw	utility_space::OUT_OF_MEMORY		If memory allocation
+//!							fails when creating an
+//!							exception.
+//! \throw	io_space::FILE_NOT_OPEN			If the file is not
+//!							opened for reading.
+//! \throw	io_space::FILE_READ_ERROR		If an error occurs while
+//!							reading or the end of
+//!							file is reached.
+//!
+//! \returns	None.
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+void	FileManager::ReadBatch(int FileDescriptor,
+		const BatchTransfer* Transfers, std_uint Count,
+		const CharString& PathName) const
+		throw(FatalException, IOException)
+	{
+	for (; Count > 0; --Count, ++Transfers)
+		if (ReadAt(FileDescriptor, Transfers->Buffer, Transfers->Size,
+			Transfers->Offset, PathName) < Transfers->Size)
+			throw make_IO_exception(FILE_READ_ERROR, PathName);
+	}
+
+////////////////////////////////////////////////////////////////////////////////
+//! \par	Description:
+//!	Write a batch of transfers at given positions of a file. \n
+//!	Default implementation, performing the transfers one at a time.
+//!
+//! \param	FileDescriptor				File descriptor of the
+//!							file.
+//! \param	Transfers				Array of the transfers.
+//! \param	Count					Number of transfers.
+//! \param	PathName				PathName of the file.
+//!
+//! \throw	utility_space::OUT_OF_MEMORY		If memory allocation
+//!							fails when creating an
+//!							exception.
+//! \throw	io_space::FILE_NOT_OPEN			If the file is not
+//!							opened for writing.
+//! \throw	io_space::FILE_WRITE_ERROR		If an error occurs while
+//!							writing.
+//!
+//! \returns	None.
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+void	FileManager::WriteBatch(int FileDescriptor,
+		const BatchTransfer* Transfers, std_uint Count,
+		const CharString& PathName) const
+		throw(FatalException, IOException)
+	{
+	for (; Count > 0; --Count, ++Transfers)
+		WriteAt(FileDescriptor, Transfers->Buffer, Transfers->Size,
+			Transfers->Offset, PathName);
+	}
+
+////////////////////////////////////////////////////////////////////////////////
+//! \par	Description:
+//!	Wait until some bytes of a file can be read without blocking, or a
+//!	given time elapses. \n
+//!	Default implementation for systems that cannot check whether a read
+//!	would block.
+//!
+//! \param	FileDescriptor				File descriptor of the
+//!							file.
+//! \param	Timeout					Maximum waiting time, in
+//!							milliseconds.
+//! \param	PathName				PathName of the file.
+//!
+//! \throw	None.
+//!
+//! \returns	bool					Always true, so that the
+//!							caller reads as it would
+//!							without checking.
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+bool	FileManager::IsInputReady(int FileDescriptor, std_uint Timeout,
+		const CharString& PathName) const
+		throw(FatalException, IOException)
+	{
+	return true;
+	}
+
+////////////////////////////////////////////////////////////////////////////////
+//! \par	Description:
+//!	Start watching the changes to a file. \n
+//!	Default implementation for systems that cannot notify the changes to
+//!	the files.
+//!
+//! \param	PathName				Path name of the file.
+//!
+//! \throw	None.
+//!
+//! \returns	int					Always NO_WATCH.
+//!
+//! \see	NO_WATCH
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+int	FileManager::WatchFile(const CharString& PathName) const
+		throw(FatalException, IOException)
+	{
+	return NO_WATCH;
+	}
+
+////////////////////////////////////////////////////////////////////////////////
+//! \par	Description:
+//!	Wait until a watched file changes, or a given time elapses. \n
+//!	Default implementation for systems that cannot notify the changes to
+//!	the files, where no watch can exist.
+//!
+//! \param	Watch					Value returned by
+//!							WatchFile.
+//! \param	Timeout					Maximum waiting time, in
+//!							milliseconds, or
+//!							WAIT_FOREVER.
+//! \param	PathName				Path name of the file.
+//!
+//! \throw	utility_space::OUT_OF_MEMORY		If memory allocation
+//!							fails when creating an
+//!							exception.
+//! \throw	utility_space::ILLEGAL_ARGUMENT		Always.
+//!
+//! \returns	Not applicable.
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+bool	FileManager::WaitForChanges(int Watch, std_uint Timeout,
+		const CharString& PathName) const
+		throw(FatalException, IOException)
+	{
+	throw make_fatal_exception(ILLEGAL_ARGUMENT);
+	}
+
+////////////////////////////////////////////////////////////////////////////////
+//! \par	Description:
+//!	Stop watching the changes to a file. \n
+//!	Default implementation for systems that cannot notify the changes to
+//!	the files.
+//!
+//! \param	Watch					Value returned by
+//!							WatchFile.
+//! \param	PathName				Path name of the file.
+//!
+//! \throw	None.
+//!
+//! \returns	None.
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+void	FileManager::CloseWatch(int Watch, const CharString& PathName)
+		const throw(FatalException, IOException)
+	{
+	}
+
 ////////////////////////////////////////////////////////////////////////////////
 //! \par	Description:
 //!	Return a pointer to the singleton instance of the FileManager object,
@@ -14,7 +14,13 @@
 # include	<dirent.h>
 # include	<unistd.h>
 # include	<errno.h>
+# include	<fcntl.h>
 # include	<sys/stat.h>
+# include	<sys/mman.h>
+# include	<sys/inotify.h>
+# include	<poll.h>
+# include	<sys/syscall.h>
+# include	<string.h>
 
 # include	"Standard.h"
 # include	"LinuxFileManager.h"
@@ -47,6 +53,52 @@
 //!	Value returned by fsync when the operation succeeds.
 # define	FSYNC_OK				0
 
+//! \def	FCNTL_OK
+//!	Value returned by fcntl when the operation succeeds.
+# define	FCNTL_OK				0
+
+//! \def	MUNMAP_OK
+//!	Value returned by munmap when the operation succeeds.
+# define	MUNMAP_OK				0
+
+//! \def	MSYNC_OK
+//!	Value returned by msync when the operation succeeds.
+# define	MSYNC_OK				0
+
+//! \def	FTRUNCATE_OK
+//!	Value returned by ftruncate when the operation succeeds.
+# define	FTRUNCATE_OK				0
+
+//! \def	INOTIFY_ERROR
+//!	Value returned by inotify_init1 or inotify_add_watch when the operation
+//!	fails.
+# define	INOTIFY_ERROR				(-1)
+
+//! \def	POLL_ERROR
+//!	Value returned by poll when the operation fails.
+# define	POLL_ERROR				(-1)
+
+//! \def	POLL_TIMEOUT
+//!	Value returned by poll when the time elapses before any event.
+# define	POLL_TIMEOUT				0
+
+//! \def	POLL_INFINITE
+//!	Timeout of poll meaning that it waits without a time limit.
+# define	POLL_INFINITE				(-1)
+
+//! \def	WATCH_CLOSE_OK
+//!	Value returned by close when the operation succeeds.
+# define	WATCH_CLOSE_OK				0
+
+//! \def	WATCH_BUFFER_SIZE
+//!	Size of the buffer receiving the events of a watch; it holds many
+//!	events, so that a burst of changes is drained with few reads.
+# define	WATCH_BUFFER_SIZE			4096
+
+//! \def	PREAD_ERROR
+//!	Value returned by pread, pwrite or read when the operation fails.
+# define	PREAD_ERROR				(-1)
+
 //! \def	DEFAULT_DIRECTORY_PERMISSIONS
 //!	Default permissions when creating a directory.
 # define	DEFAULT_DIRECTORY_PERMISSIONS		0777
@@ -61,6 +113,23 @@ namespace	io_space
 using	namespace	utility_space;
 using	namespace	data_structure_space;
 
+////////////////////////////////////////////////////////////////////////////////
+//! \par	Description:
+//!	Destructor; it releases the io_uring instance, if any.
+//!
+//! \throw	None.
+//!
+//! \returns	Not applicable.
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+LinuxFileManager::~LinuxFileManager(void) noexcept
+	{
+# if	defined USE_IO_URING
+	StopRing();
+# endif
+	}
+
 ////////////////////////////////////////////////////////////////////////////////
 //! \par	Description:
 //!	Check whether a path name refers a directory or not.
@@ -414,6 +483,947 @@ void	LinuxFileManager::Unlock(int FileDescriptor, std_uint Size,
 		}
 	}
 
+////////////////////////////////////////////////////////////////////////////////
+//! \par	Description:
+//!	Lock a given number of bytes, from a given position.
+//!
+//! \param	FileDescriptor				File descriptor of the
+//!							file.
+//! \param	Offset					Position of the first
+//!							byte to lock.
+//! \param	Size					Number of bytes to lock.
+//! \param	PathName				PathName of the file.
+//!
+//! \throw	utility_space::OUT_OF_MEMORY		If memory allocation
+//!							fails when creating an
+//!							exception.
+//! \throw	io_space::FILE_NOT_OPEN			If the file has not been
+//!							opened in write or
+//!							read-write or update
+//!							mode.
+//! \throw	io_space::FILE_DEADLOCK			If the lock would cause
+//!							a deadlock.
+//! \throw	io_space::TOO_MANY_LOCKS		If there are too many
+//!							locks.
+//!
+//! \returns	None
+//!
+//! \note
+//!	The lock is the same record lock set by Lock, so the two functions can
+//!	be used together, also by different processes. \n
+//!	The current position of the file is not changed.
+//!
+//! \note
+//!	If the locked part overlaps a part that has been locked by another
+//!	process, the function waits for the other process to unlock the part.
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+void	LinuxFileManager::LockAt(int FileDescriptor, std_ulong Offset,
+		std_uint Size, const CharString& PathName) const
+		throw(FatalException, IOException)
+	{
+	struct	flock	LockData;
+
+	LockData.l_type = F_WRLCK;
+	LockData.l_whence = SEEK_SET;
+	LockData.l_start = static_cast<off_t>(Offset);
+	LockData.l_len = static_cast<off_t>(Size);
+	while (fcntl(FileDescriptor, F_SETLKW, &LockData) != FCNTL_OK)
+		if (errno != EINTR)
+			{
+			if (errno == EBADF)
+				throw make_IO_exception(FILE_NOT_OPEN,
+					PathName);
+			throw make_IO_exception(MakeExceptionKind(errno),
+				PathName);
+			}
+	}
+
+////////////////////////////////////////////////////////////////////////////////
+//! \par	Description:
+//!	Unlock a given number of bytes, from a given position.
+//!
+//! \param	FileDescriptor				File descriptor of the
+//!							file.
+//! \param	Offset					Position of the first
+//!							byte to unlock.
+//! \param	Size					Number of bytes to
+//!							unlock.
+//! \param	PathName				PathName of the file.
+//!
+//! \throw	utility_space::OUT_OF_MEMORY		If memory allocation
+//!							fails when creating an
+//!							exception.
+//! \throw	io_space::FILE_NOT_OPEN			If the file has not been
+//!							opened in write or
+//!							read-write or update
+//!							mode.
+//!
+//! \returns	None
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+void	LinuxFileManager::UnlockAt(int FileDescriptor, std_ulong Offset,
+		std_uint Size, const CharString& PathName) const
+		throw(FatalException, IOException)
+	{
+	struct	flock	LockData;
+
+	LockData.l_type = F_UNLCK;
+	LockData.l_whence = SEEK_SET;
+	LockData.l_start = static_cast<off_t>(Offset);
+	LockData.l_len = static_cast<off_t>(Size);
+	if (fcntl(FileDescriptor, F_SETLK, &LockData) != FCNTL_OK)
+		{
+		if (errno == EBADF)
+			throw make_IO_exception(FILE_NOT_OPEN, PathName);
+		throw make_IO_exception(MakeExceptionKind(errno), PathName);
+		}
+	}
+
+////////////////////////////////////////////////////////////////////////////////
+//! \par	Description:
+//!	Change the length of a file.
+//!
+//! \param	FileDescriptor				File descriptor of the
+//!							file.
+//! \param	Size					New length of the file.
+//! \param	PathName				PathName of the file.
+//!
+//! \throw	utility_space::OUT_OF_MEMORY		If memory allocation
+//!							fails when creating an
+//!							exception.
+//! \throw	io_space::FILE_NOT_OPEN			If the file has not been
+//!							opened in write or
+//!							read-write or update
+//!							mode.
+//! \throw	io_space::FILE_WRITE_ERROR		If an error occurs while
+//!							writing.
+//!
+//! \returns	None
+//!
+//! \note
+//!	If the file is extended, the new bytes are zero.
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+void	LinuxFileManager::Truncate(int FileDescriptor, std_ulong Size,
+		const CharString& PathName) const
+		throw(FatalException, IOException)
+	{
+	while (ftruncate(FileDescriptor, static_cast<off_t>(Size)) !=
+		FTRUNCATE_OK)
+		if (errno != EINTR)
+			{
+			if (errno == EBADF or errno == EINVAL)
+				throw make_IO_exception(FILE_NOT_OPEN,
+					PathName);
+			throw make_IO_exception(FILE_WRITE_ERROR, PathName);
+			}
+	}
+
+////////////////////////////////////////////////////////////////////////////////
+//! \par	Description:
+//!	Read a given number of bytes, from a given position.
+//!
+//! \param	FileDescriptor				File descriptor of the
+//!							file.
+//! \param	Destination				Pointer to the buffer
+//!							that upon return will
+//!							contain the bytes read.
+//! \param	Size					Number of bytes to read.
+//! \param	Offset					Position of the first
+//!							byte to read.
+//! \param	PathName				PathName of the file.
+//!
+//! \throw	utility_space::OUT_OF_MEMORY		If memory allocation
+//!							fails when creating an
+//!							exception.
+//! \throw	io_space::FILE_NOT_OPEN			If the file is not
+//!							opened for reading.
+//! \throw	io_space::FILE_READ_ERROR		If an error occurs while
+//!							reading.
+//!
+//! \returns	std_uint				The number of bytes
+//!							read, less than Size
+//!							only if the end of file
+//!							is reached.
+//!
+//! \note
+//!	The current position of the file is not changed.
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+std_uint	LinuxFileManager::ReadAt(int FileDescriptor, void* Destination,
+			std_uint Size, std_ulong Offset,
+			const CharString& PathName) const
+			throw(FatalException, IOException)
+	{
+	register	std_uint	Done;
+	register	ssize_t		Result;
+
+	for (Done = 0; Done < Size; Done += static_cast<std_uint>(Result))
+		{
+		if ((Result = pread(FileDescriptor,
+			static_cast<byte*>(Destination) + Done, Size - Done,
+			static_cast<off_t>(Offset + Done))) == PREAD_ERROR)
+			{
+			if (errno == EINTR)
+				{
+				Result = 0;
+				continue;
+				}
+			if (errno == EBADF)
+				throw make_IO_exception(FILE_NOT_OPEN,
+					PathName);
+			throw make_IO_exception(FILE_READ_ERROR, PathName);
+			}
+		if (Result == 0)
+			break;
+		}
+	return Done;
+	}
+
+////////////////////////////////////////////////////////////////////////////////
+//! \par	Description:
+//!	Write a given number of bytes, from a given position.
+//!
+//! \param	FileDescriptor				File descriptor of the
+//!							file.
+//! \param	Source					Pointer to the bytes to
+//!							write.
+//! \param	Size					Number of bytes to
+//!							write.
+//! \param	Offset					Position of the first
+//!							byte to write.
+//! \param	PathName				PathName of the file.
+//!
+//! \throw	utility_space::OUT_OF_MEMORY		If memory allocation
+//!							fails when creating an
+//!							exception.
+//! \throw	io_space::FILE_NOT_OPEN			If the file is not
+//!							opened for writing.
+//! \throw	io_space::FILE_WRITE_ERROR		If an error occurs while
+//!							writing.
+//!
+//! \returns	None
+//!
+//! \note
+//!	The current position of the file is not changed.
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+void	LinuxFileManager::WriteAt(int FileDescriptor, const void* Source,
+		std_uint Size, std_ulong Offset, const CharString& PathName)
+		const throw(FatalException, IOException)
+	{
+	register	std_uint	Done;
+	register	ssize_t		Result;
+
+	for (Done = 0; Done < Size; Done += static_cast<std_uint>(Result))
+		if ((Result = pwrite(FileDescriptor,
+			static_cast<const byte*>(Source) + Done, Size - Done,
+			static_cast<off_t>(Offset + Done))) == PREAD_ERROR)
+			{
+			if (errno == EINTR)
+				{
+				Result = 0;
+				continue;
+				}
+			if (errno == EBADF)
+				throw make_IO_exception(FILE_NOT_OPEN,
+					PathName);
+			throw make_IO_exception(FILE_WRITE_ERROR, PathName);
+			}
+	}
+
+////////////////////////////////////////////////////////////////////////////////
+//! \par	Description:
+//!	Check whether batches of transfers are performed asynchronously, so
+//!	that submitting many transfers together is faster than performing them
+//!	one at a time.
+//!
+//! \throw	None.
+//!
+//! \returns	bool					true if the program has
+//!							been compiled with
+//!							USE_IO_URING and the
+//!							kernel allows to create
+//!							an io_uring instance.
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+bool	LinuxFileManager::IsBatchAsynchronous(void) const noexcept
+	{
+# if	defined USE_IO_URING
+	return StartRing();
+# else
+	return false;
+# endif
+	}
+
+////////////////////////////////////////////////////////////////////////////////
+//! \par	Description:
+//!	Read a batch of transfers from given positions of a file, submitting
+//!	them together to the kernel when possible.
+//!
+//! \param	FileDescriptor				File descriptor of the
+//!							file.
+//! \param	Transfers				Array of the transfers.
+//! \param	Count					Number of transfers.
+//! \param	PathName				PathName of the file.
+//!
+//! \throw	utility_space::OUT_OF_MEMORY		If memory allocation
+//!							fails when creating an
+//!							exception.
+//! \throw	io_space::FILE_NOT_OPEN			If the file is not
+//!							opened for reading.
+//! \throw	io_space::FILE_READ_ERROR		If an error occurs while
+//!							reading or the end of
+//!							file is reached.
+//!
+//! \returns	None.
+//!
+//! \see	IsBatchAsynchronous
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+void	LinuxFileManager::ReadBatch(int FileDescriptor,
+		const BatchTransfer* Transfers, std_uint Count,
+		const CharString& PathName) const
+		throw(FatalException, IOException)
+	{
+# if	defined USE_IO_URING
+	if (TransferBatch(FileDescriptor, Transfers, Count, false, PathName))
+		return;
+# endif
+	FileManager::ReadBatch(FileDescriptor, Transfers, Count, PathName);
+	}
+
+////////////////////////////////////////////////////////////////////////////////
+//! \par	Description:
+//!	Write a batch of transfers at given positions of a file, submitting
+//!	them together to the kernel when possible.
+//!
+//! \param	FileDescriptor				File descriptor of the
+//!							file.
+//! \param	Transfers				Array of the transfers.
+//! \param	Count					Number of transfers.
+//! \param	PathName				PathName of the file.
+//!
+//! \throw	utility_space::OUT_OF_MEMORY		If memory allocation
+//!							fails when creating an
+//!							exception.
+//! \throw	io_space::FILE_NOT_OPEN			If the file is not
+//!							opened for writing.
+//! \throw	io_space::FILE_WRITE_ERROR		If an error occurs while
+//!							writing.
+//!
+//! \returns	None.
+//!
+//! \see	IsBatchAsynchronous
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+void	LinuxFileManager::WriteBatch(int FileDescriptor,
+		const BatchTransfer* Transfers, std_uint Count,
+		const CharString& PathName) const
+		throw(FatalException, IOException)
+	{
+# if	defined USE_IO_URING
+	if (TransferBatch(FileDescriptor, Transfers, Count, true, PathName))
+		return;
+# endif
+	FileManager::WriteBatch(FileDescriptor, Transfers, Count, PathName);
+	}
+
+# if	defined USE_IO_URING
+////////////////////////////////////////////////////////////////////////////////
+//! \par	Description:
+//!	Create the io_uring instance used for batches of transfers, if not yet
+//!	done.
+//!
+//! \throw	None.
+//!
+//! \returns	bool					true if the instance is
+//!							available.
+//!
+//! \note
+//!	The instance is created with raw system calls, so no library is needed;
+//!	if the kernel does not allow it, the function fails only once and the
+//!	transfers are performed one at a time.
+//!
+//! \see	RING_ENTRIES
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+bool	LinuxFileManager::StartRing(void) const noexcept
+	{
+	register	long		Descriptor;
+	register	std_uint	Index;
+	register	void*		Address;
+
+	if (RingDescriptor != RING_NOT_STARTED)
+		return RingDescriptor != RING_UNAVAILABLE;
+	RingDescriptor = RING_UNAVAILABLE;
+	ignore_value(memset(&RingParameters, 0, sizeof(RingParameters)));
+	if ((Descriptor = syscall(__NR_io_uring_setup, RING_ENTRIES,
+		&RingParameters)) < 0)
+		return false;
+	RingDescriptor = static_cast<int>(Descriptor);
+	SubmissionRingSize = RingParameters.sq_off.array +
+		RingParameters.sq_entries * sizeof(__u32);
+	CompletionRingSize = RingParameters.cq_off.cqes +
+		RingParameters.cq_entries * sizeof(io_uring_cqe);
+	if ((RingParameters.features & IORING_FEAT_SINGLE_MMAP) != 0 and
+		SubmissionRingSize < CompletionRingSize)
+		SubmissionRingSize = CompletionRingSize;
+	if ((Address = mmap(nullptr, SubmissionRingSize, PROT_READ | PROT_WRITE,
+		MAP_SHARED | MAP_POPULATE, RingDescriptor, IORING_OFF_SQ_RING))
+		== MAP_FAILED)
+		{
+		StopRing();
+		return false;
+		}
+	SubmissionRing = static_cast<byte*>(Address);
+	if ((RingParameters.features & IORING_FEAT_SINGLE_MMAP) != 0)
+		CompletionRing = SubmissionRing;
+	else
+		{
+		if ((Address = mmap(nullptr, CompletionRingSize,
+			PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+			RingDescriptor, IORING_OFF_CQ_RING)) == MAP_FAILED)
+			{
+			StopRing();
+			return false;
+			}
+		CompletionRing = static_cast<byte*>(Address);
+		}
+	if ((Address = mmap(nullptr, RingParameters.sq_entries *
+		sizeof(io_uring_sqe), PROT_READ | PROT_WRITE,
+		MAP_SHARED | MAP_POPULATE, RingDescriptor, IORING_OFF_SQES)) ==
+		MAP_FAILED)
+		{
+		StopRing();
+		return false;
+		}
+	SubmissionEntries = static_cast<io_uring_sqe*>(Address);
+	for (Index = 0; Index < RingParameters.sq_entries; ++Index)
+		reinterpret_cast<__u32*>(SubmissionRing +
+			RingParameters.sq_off.array) [Index] = Index;
+	return true;
+	}
+
+////////////////////////////////////////////////////////////////////////////////
+//! \par	Description:
+//!	Release the io_uring instance, if any; afterwards batches of transfers
+//!	are performed one at a time.
+//!
+//! \throw	None.
+//!
+//! \returns	None.
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+void	LinuxFileManager::StopRing(void) const noexcept
+	{
+	if (SubmissionEntries != nullptr)
+		ignore_value(munmap(SubmissionEntries,
+			RingParameters.sq_entries * sizeof(io_uring_sqe)));
+	if (CompletionRing != nullptr and CompletionRing != SubmissionRing)
+		ignore_value(munmap(CompletionRing, CompletionRingSize));
+	if (SubmissionRing != nullptr)
+		ignore_value(munmap(SubmissionRing, SubmissionRingSize));
+	if (RingDescriptor >= 0)
+		ignore_value(close(RingDescriptor));
+	SubmissionEntries = nullptr;
+	CompletionRing = SubmissionRing = nullptr;
+	if (RingDescriptor != RING_NOT_STARTED)
+		RingDescriptor = RING_UNAVAILABLE;
+	}
+
+////////////////////////////////////////////////////////////////////////////////
+//! \par	Description:
+//!	Perform a batch of transfers with the io_uring instance: all the
+//!	transfers that fit in the submission queue are submitted with a single
+//!	system call, which also waits for their completion.
+//!
+//! \param	FileDescriptor				File descriptor of the
+//!							file.
+//! \param	Transfers				Array of the transfers.
+//! \param	Count					Number of transfers.
+//! \param	Write					true to write, false to
+//!							read.
+//! \param	PathName				PathName of the file.
+//!
+//! \throw	utility_space::OUT_OF_MEMORY		If memory allocation
+//!							fails when creating an
+//!							exception.
+//! \throw	io_space::FILE_NOT_OPEN			If the file is not
+//!							opened in a suitable
+//!							mode.
+//! \throw	io_space::FILE_READ_ERROR		If an error occurs while
+//!							reading or the end of
+//!							file is reached.
+//! \throw	io_space::FILE_WRITE_ERROR		If an error occurs while
+//!							writing.
+//!
+//! \returns	bool					false if the io_uring
+//!							instance is not
+//!							available and no
+//!							transfer has been
+//!							performed.
+//!
+//! \note
+//!	The transfers that fail or are partially performed are repeated one at
+//!	a time, so that errors are reported as usual.
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+bool	LinuxFileManager::TransferBatch(int FileDescriptor,
+		const BatchTransfer* Transfers, std_uint Count, bool Write,
+		const CharString& PathName) const
+		throw(FatalException, IOException)
+	{
+	register	std_uint	First;
+	register	std_uint	Size;
+	register	std_uint	Index;
+	register	std_uint	Submitted;
+	register	std_uint	Completed;
+	register	std_uint	Failed;
+	register	std_uint	Head;
+	register	std_uint	Tail;
+	register	long		Result;
+	register	io_uring_sqe*	Entry;
+	register	io_uring_cqe*	Completion;
+			std_uint	Retry [RING_ENTRIES];
+
+	if (not StartRing())
+		return false;
+	for (First = 0; First < Count; First += Size)
+		{
+		Size = Count - First;
+		if (Size > RingParameters.sq_entries)
+			Size = RingParameters.sq_entries;
+		if (Size > RING_ENTRIES)
+			Size = RING_ENTRIES;
+		Tail = *reinterpret_cast<__u32*>(SubmissionRing +
+			RingParameters.sq_off.tail);
+		for (Index = 0; Index < Size; ++Index)
+			{
+			Entry = SubmissionEntries + ((Tail + Index) &
+				*reinterpret_cast<__u32*>(SubmissionRing +
+				RingParameters.sq_off.ring_mask));
+			ignore_value(memset(Entry, 0, sizeof(*Entry)));
+			Entry->opcode = Write ? IORING_OP_WRITE : IORING_OP_READ;
+			Entry->fd = FileDescriptor;
+			Entry->addr = reinterpret_cast<std_ulong>(
+				Transfers [First + Index].Buffer);
+			Entry->len = Transfers [First + Index].Size;
+			Entry->off = Transfers [First + Index].Offset;
+			Entry->user_data = First + Index;
+			}
+		__atomic_store_n(reinterpret_cast<__u32*>(SubmissionRing +
+			RingParameters.sq_off.tail), Tail + Size,
+			__ATOMIC_RELEASE);
+		for (Submitted = Completed = Failed = 0; Completed < Size;)
+			{
+			if ((Result = syscall(__NR_io_uring_enter, RingDescriptor,
+				Size - Submitted, Size - Completed,
+				IORING_ENTER_GETEVENTS, nullptr, 0)) < 0)
+				{
+				if (errno == EINTR)
+					continue;
+				StopRing();
+				throw make_IO_exception(Write ?
+					FILE_WRITE_ERROR : FILE_READ_ERROR,
+					PathName);
+				}
+			Submitted += static_cast<std_uint>(Result);
+			Head = *reinterpret_cast<__u32*>(CompletionRing +
+				RingParameters.cq_off.head);
+			for (; Head != __atomic_load_n(reinterpret_cast<__u32*>(
+				CompletionRing + RingParameters.cq_off.tail),
+				__ATOMIC_ACQUIRE); ++Head, ++Completed)
+				{
+				Completion = reinterpret_cast<io_uring_cqe*>(
+					CompletionRing +
+					RingParameters.cq_off.cqes) + (Head &
+					*reinterpret_cast<__u32*>(
+					CompletionRing +
+					RingParameters.cq_off.ring_mask));
+				if (Completion->res < 0 or static_cast<std_uint>(
+					Completion->res) != Transfers [
+					Completion->user_data].Size)
+					Retry [Failed++] = static_cast<std_uint>(
+						Completion->user_data);
+				}
+			__atomic_store_n(reinterpret_cast<__u32*>(
+				CompletionRing + RingParameters.cq_off.head),
+				Head, __ATOMIC_RELEASE);
+			}
+		for (Index = 0; Index < Failed; ++Index)
+			if (Write)
+				FileManager::WriteBatch(FileDescriptor,
+					Transfers + Retry [Index], 1, PathName);
+			else
+				FileManager::ReadBatch(FileDescriptor,
+					Transfers + Retry [Index], 1, PathName);
+		}
+	return true;
+	}
+# endif
+
+////////////////////////////////////////////////////////////////////////////////
+//! \par	Description:
+//!	Map the first bytes of a file in memory, shared with the other
+//!	processes.
+//!
+//! \param	FileDescriptor				File descriptor of the
+//!							file.
+//! \param	Size					Number of bytes to map.
+//! \param	Writable				True if the mapped bytes
+//!							can be modified.
+//! \param	PathName				PathName of the file.
+//!
+//! \throw	utility_space::OUT_OF_MEMORY		If memory allocation
+//!							fails when creating an
+//!							exception.
+//! \throw	io_space::FILE_NOT_OPEN			If the file is not
+//!							opened.
+//! \throw	io_space::FILE_PERMISSION_DENIED	If the file has not been
+//!							opened in a mode
+//!							compatible with the
+//!							mapping.
+//! \throw	io_space::FILE_INVALID_PATH_NAME	If the file cannot be
+//!							mapped or Size is 0.
+//! \throw	io_space::FILE_IO_ERROR			If there is not enough
+//!							address space.
+//!
+//! \returns	void*					The address of the first
+//!							mapped byte.
+//!
+//! \note
+//!	The changes to the mapped bytes are written to the file by the system;
+//!	SynchronizeMap waits until they are written to the disk.
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+void*	LinuxFileManager::Map(int FileDescriptor, std_ulong Size,
+		bool Writable, const CharString& PathName) const
+		throw(FatalException, IOException)
+	{
+	register	void*	Address;
+
+	if ((Address = mmap(nullptr, static_cast<size_t>(Size),
+		Writable ? PROT_READ | PROT_WRITE : PROT_READ, MAP_SHARED,
+		FileDescriptor, 0)) == MAP_FAILED)
+		{
+		if (errno == EBADF)
+			throw make_IO_exception(FILE_NOT_OPEN, PathName);
+		throw make_IO_exception(MakeExceptionKind(errno), PathName);
+		}
+	return Address;
+	}
+
+////////////////////////////////////////////////////////////////////////////////
+//! \par	Description:
+//!	Remove a mapping created by Map.
+//!
+//! \param	Address					Address returned by Map.
+//! \param	Size					Number of bytes mapped.
+//!
+//! \throw	utility_space::OUT_OF_MEMORY		If memory allocation
+//!							fails when creating an
+//!							exception.
+//! \throw	utility_space::ILLEGAL_ARGUMENT		If the arguments do not
+//!							correspond to a mapping.
+//!
+//! \returns	None
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+void	LinuxFileManager::Unmap(void* Address, std_ulong Size) const
+		throw(FatalException)
+	{
+	if (munmap(Address, static_cast<size_t>(Size)) != MUNMAP_OK)
+		throw make_fatal_exception(ILLEGAL_ARGUMENT);
+	}
+
+////////////////////////////////////////////////////////////////////////////////
+//! \par	Description:
+//!	Write the changed bytes of a part of a mapping to the disk.
+//!
+//! \param	Address					Address of the first
+//!							byte to write; it needs
+//!							not be aligned to a
+//!							page.
+//! \param	Size					Number of bytes to
+//!							write.
+//! \param	PathName				PathName of the file.
+//!
+//! \throw	utility_space::OUT_OF_MEMORY		If memory allocation
+//!							fails when creating an
+//!							exception.
+//! \throw	io_space::FILE_WRITE_ERROR		If an error occurs while
+//!							writing.
+//!
+//! \returns	None
+//!
+//! \note
+//!	Only the pages containing the given bytes are written; the function
+//!	returns after the data have been written.
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+void	LinuxFileManager::SynchronizeMap(const void* Address, std_ulong Size,
+		const CharString& PathName) const
+		throw(FatalException, IOException)
+	{
+	register	std_ulong	Start;
+	register	std_ulong	PageSize;
+
+	PageSize = static_cast<std_ulong>(sysconf(_SC_PAGESIZE));
+	Start = reinterpret_cast<std_ulong>(Address);
+	Size += Start % PageSize;
+	Start -= Start % PageSize;
+	if (msync(reinterpret_cast<void*>(Start), static_cast<size_t>(Size),
+		MS_SYNC) != MSYNC_OK)
+		throw make_IO_exception(FILE_WRITE_ERROR, PathName);
+	}
+
+////////////////////////////////////////////////////////////////////////////////
+//! \par	Description:
+//!	Read the bytes of a file available at the current position, up to a
+//!	given number, waiting only if none is available.
+//!
+//! \param	FileDescriptor				File descriptor of the
+//!							file.
+//! \param	Destination				Pointer to the buffer
+//!							that upon return will
+//!							contain the bytes read.
+//! \param	Size					Maximum number of bytes
+//!							to read.
+//! \param	PathName				PathName of the file.
+//!
+//! \throw	utility_space::OUT_OF_MEMORY		If memory allocation
+//!							fails when creating an
+//!							exception.
+//! \throw	io_space::FILE_NOT_OPEN			If the file is not
+//!							opened for reading.
+//! \throw	io_space::FILE_READ_ERROR		If an error occurs while
+//!							reading.
+//!
+//! \returns	std_uint				The number of bytes
+//!							read, zero only if the
+//!							end of file is reached.
+//!
+//! \note
+//!	If the read is interrupted by a signal, it is restarted.
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+std_uint	LinuxFileManager::ReadInput(int FileDescriptor,
+			void* Destination, std_uint Size,
+			const CharString& PathName) const
+			throw(FatalException, IOException)
+	{
+	register	ssize_t		Result;
+
+	while ((Result = read(FileDescriptor, Destination, Size)) ==
+		PREAD_ERROR)
+		{
+		if (errno == EINTR)
+			continue;
+		if (errno == EBADF)
+			throw make_IO_exception(FILE_NOT_OPEN, PathName);
+		throw make_IO_exception(FILE_READ_ERROR, PathName);
+		}
+	return static_cast<std_uint>(Result);
+	}
+
+////////////////////////////////////////////////////////////////////////////////
+//! \par	Description:
+//!	Wait until some bytes of a file can be read without blocking, or a
+//!	given time elapses.
+//!
+//! \param	FileDescriptor				File descriptor of the
+//!							file.
+//! \param	Timeout					Maximum waiting time, in
+//!							milliseconds; if 0, the
+//!							function does not wait.
+//! \param	PathName				PathName of the file.
+//!
+//! \throw	utility_space::OUT_OF_MEMORY		If memory allocation
+//!							fails when creating an
+//!							exception.
+//! \throw	io_space::FILE_READ_ERROR		If an error occurs while
+//!							waiting.
+//!
+//! \returns	bool					true if some bytes, or
+//!							the end of file, can be
+//!							read, false if the time
+//!							elapsed.
+//!
+//! \note
+//!	Only the file descriptor is checked, so the caller must not have read
+//!	ahead bytes it has not used yet. \n
+//!	If the wait is interrupted by a signal, it restarts with the whole
+//!	timeout.
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+bool	LinuxFileManager::IsInputReady(int FileDescriptor, std_uint Timeout,
+		const CharString& PathName) const
+		throw(FatalException, IOException)
+	{
+	register	int		Result;
+	struct		pollfd		PollData;
+
+	PollData.fd = FileDescriptor;
+	PollData.events = POLLIN;
+	while ((Result = poll(&PollData, 1, static_cast<int>(Timeout))) ==
+		POLL_ERROR)
+		if (errno != EINTR)
+			throw make_IO_exception(FILE_READ_ERROR, PathName);
+	return Result != POLL_TIMEOUT;
+	}
+
+////////////////////////////////////////////////////////////////////////////////
+//! \par	Description:
+//!	Start watching the changes to a file, using inotify.
+//!
+//! \param	PathName				Path name of the file.
+//!
+//! \throw	utility_space::OUT_OF_MEMORY		If memory allocation
+//!							fails when creating an
+//!							exception.
+//! \throw	io_space::FILE_INVALID_PATH_NAME	If the path name is not
+//!							valid.
+//! \throw	io_space::FILE_DOES_NOT_EXIST		If the file does not
+//!							exist.
+//! \throw	io_space::FILE_PERMISSION_DENIED	If user has no
+//!							permission to read the
+//!							file.
+//! \throw	io_space::TOO_MANY_OPEN_FILES		If trying to open too
+//!							many files.
+//! \throw	io_space::FILE_IO_ERROR			If too many watches
+//!							exist.
+//!
+//! \returns	int					The descriptor of the
+//!							watch, or NO_WATCH if
+//!							the kernel does not
+//!							support inotify.
+//!
+//! \note
+//!	A change is notified when the file is written or truncated by a system
+//!	call; the changes made through a mapping are not notified.
+//!
+//! \see	NO_WATCH
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+int	LinuxFileManager::WatchFile(const CharString& PathName) const
+		throw(FatalException, IOException)
+	{
+	register	int	Watch;
+	register	int	Error;
+
+	if ((Watch = inotify_init1(IN_NONBLOCK | IN_CLOEXEC)) == INOTIFY_ERROR)
+		{
+		if (errno == ENOSYS)
+			return NO_WATCH;
+		throw make_IO_exception(MakeExceptionKind(errno), PathName);
+		}
+	if (inotify_add_watch(Watch, PathName.GetString(), IN_MODIFY) ==
+		INOTIFY_ERROR)
+		{
+		Error = errno;
+		ignore_value(close(Watch));
+		throw make_IO_exception(MakeExceptionKind(Error), PathName);
+		}
+	return Watch;
+	}
+
+////////////////////////////////////////////////////////////////////////////////
+//! \par	Description:
+//!	Wait until a watched file changes, or a given time elapses; all the
+//!	changes notified are consumed.
+//!
+//! \param	Watch					Value returned by
+//!							WatchFile.
+//! \param	Timeout					Maximum waiting time, in
+//!							milliseconds, or
+//!							WAIT_FOREVER; if 0, the
+//!							function does not wait.
+//! \param	PathName				Path name of the file.
+//!
+//! \throw	utility_space::OUT_OF_MEMORY		If memory allocation
+//!							fails when creating an
+//!							exception.
+//! \throw	io_space::FILE_READ_ERROR		If an error occurs while
+//!							reading the changes.
+//!
+//! \returns	bool					true if the file
+//!							changed, false if the
+//!							time elapsed.
+//!
+//! \note
+//!	If the wait is interrupted by a signal, it restarts with the whole
+//!	timeout.
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+bool	LinuxFileManager::WaitForChanges(int Watch, std_uint Timeout,
+		const CharString& PathName) const
+		throw(FatalException, IOException)
+	{
+	register	int		Result;
+	struct		pollfd		PollData;
+	alignas(struct inotify_event)	char	Buffer [WATCH_BUFFER_SIZE];
+
+	PollData.fd = Watch;
+	PollData.events = POLLIN;
+	while ((Result = poll(&PollData, 1, Timeout == WAIT_FOREVER?
+		POLL_INFINITE: static_cast<int>(Timeout))) == POLL_ERROR)
+		if (errno != EINTR)
+			throw make_IO_exception(FILE_READ_ERROR, PathName);
+	if (Result == POLL_TIMEOUT)
+		return false;
+	while (read(Watch, Buffer, WATCH_BUFFER_SIZE) != PREAD_ERROR or
+		errno == EINTR)
+		;
+	if (errno != EAGAIN)
+		throw make_IO_exception(FILE_READ_ERROR, PathName);
+	return true;
+	}
+
+////////////////////////////////////////////////////////////////////////////////
+//! \par	Description:
+//!	Stop watching the changes to a file.
+//!
+//! \param	Watch					Value returned by
+//!							WatchFile.
+//! \param	PathName				Path name of the file.
+//!
+//! \throw	utility_space::OUT_OF_MEMORY		If memory allocation
+//!							fails when creating an
+//!							exception.
+//! \throw	io_space::FILE_CLOSE_ERROR		If an error occurs while
+//!							closing the watch.
+//!
+//! \returns	None.
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+void	LinuxFileManager::CloseWatch(int Watch, const CharString& PathName)
+		const throw(FatalException, IOException)
+	{
+	if (close(Watch) != WATCH_CLOSE_OK)
+		throw make_IO_exception(FILE_CLOSE_ERROR, PathName);
+	}
+
 ////////////////////////////////////////////////////////////////////////////////
 //! \par	Description:
 //!	Return the file exception corresponding to a standard error.
@@ -12,6 +12,10 @@
 ////////////////////////////////////////////////////////////////////////////////
 
 # include	<time.h>
+# include	<ctype.h>
+# include	<errno.h>
+# include	<fcntl.h>
+# include	<pthread.h>
 # include	<sys/times.h>
 # include	"Standard.h"
 # include	"LinuxSystemManager.h"
@@ -25,6 +29,21 @@
 //!	sleeping time expires.
 # define	NANOSLEEP_OK			0
 
+//! \def	PTHREAD_OK
+//!	Value returned by pthread functions when the operation succeeds.
+# define	PTHREAD_OK			0
+
+//! \def	BOOT_IDENTIFIER_PATH
+//!	Path name of the file containing the kernel boot identifier.
+# define	BOOT_IDENTIFIER_PATH		"/proc/sys/kernel/random/boot_id"
+
+//! \def	BOOT_IDENTIFIER_LENGTH
+//!	Maximum length of the kernel boot identifier.
+# define	BOOT_IDENTIFIER_LENGTH		64
+
+static_assert(sizeof(pthread_mutex_t) <= SHARED_LOCK_SIZE,
+	"Wrong SHARED_LOCK_SIZE, less than the size of a mutex");
+
 namespace	system_space
 {
 
@@ -122,4 +141,123 @@ void	LinuxSystemManager::Sleep(std_uint SleepTime) const noexcept
 		TimeStruct = RemainingTime;
 	}
 
+////////////////////////////////////////////////////////////////////////////////
+//! \par	Description:
+//!	Initialize a lock shared by the processes that map the memory containing
+//!	it.
+//!
+//! \param	Lock				Pointer to SHARED_LOCK_SIZE
+//!						bytes of shared memory.
+//!
+//! \throw	None.
+//!
+//! \returns	bool				true if the lock has been
+//!						initialized.
+//!
+//! \note
+//!	The lock is a robust process-shared mutex: if its owner terminates, the
+//!	next process acquiring it is notified.
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+bool	LinuxSystemManager::InitializeSharedLock(void* Lock) const noexcept
+	{
+	register	bool			Result;
+			pthread_mutexattr_t	Attributes;
+
+	if (pthread_mutexattr_init(&Attributes) != PTHREAD_OK)
+		return false;
+	Result = pthread_mutexattr_setpshared(&Attributes,
+		PTHREAD_PROCESS_SHARED) == PTHREAD_OK and
+		pthread_mutexattr_setrobust(&Attributes, PTHREAD_MUTEX_ROBUST) ==
+		PTHREAD_OK and pthread_mutex_init(static_cast<pthread_mutex_t*>(
+		Lock), &Attributes) == PTHREAD_OK;
+	ignore_value(pthread_mutexattr_destroy(&Attributes));
+	return Result;
+	}
+
+////////////////////////////////////////////////////////////////////////////////
+//! \par	Description:
+//!	Acquire a shared lock, waiting until it is released by its owner.
+//!
+//! \param	Lock				Pointer to the lock.
+//!
+//! \throw	None.
+//!
+//! \returns	bool				false if the previous owner
+//!						terminated without releasing
+//!						the lock, true otherwise.
+//!
+//! \note
+//!	When the previous owner terminated, the lock is anyway acquired and made
+//!	usable again; no system call is made if the lock is free.
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+bool	LinuxSystemManager::AcquireSharedLock(void* Lock) const noexcept
+	{
+	if (pthread_mutex_lock(static_cast<pthread_mutex_t*>(Lock)) !=
+		EOWNERDEAD)
+		return true;
+	ignore_value(pthread_mutex_consistent(static_cast<pthread_mutex_t*>(
+		Lock)));
+	return false;
+	}
+
+////////////////////////////////////////////////////////////////////////////////
+//! \par	Description:
+//!	Release a shared lock acquired by AcquireSharedLock.
+//!
+//! \param	Lock				Pointer to the lock.
+//!
+//! \throw	None.
+//!
+//! \returns	None.
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+void	LinuxSystemManager::ReleaseSharedLock(void* Lock) const noexcept
+	{
+	ignore_value(pthread_mutex_unlock(static_cast<pthread_mutex_t*>(Lock)));
+	}
+
+////////////////////////////////////////////////////////////////////////////////
+//! \par	Description:
+//!	Get a number identifying the current boot of the system, so that data
+//!	left in files by a previous boot can be recognized.
+//!
+//! \throw	None.
+//!
+//! \returns	std_ulong	The first 64 bits of the kernel boot
+//!				identifier, or 0 if it cannot be read.
+//!
+//! \see	BOOT_IDENTIFIER_PATH
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+std_ulong	LinuxSystemManager::GetBootIdentifier(void) const noexcept
+	{
+	register	int		Descriptor;
+	register	ssize_t		Length;
+	register	ssize_t		Index;
+	register	std_ulong	Identifier;
+	register	std_uint	Digits;
+			char		Buffer [BOOT_IDENTIFIER_LENGTH];
+
+	if ((Descriptor = open(BOOT_IDENTIFIER_PATH, O_RDONLY)) < 0)
+		return 0;
+	Length = read(Descriptor, Buffer, sizeof(Buffer));
+	ignore_value(close(Descriptor));
+	for (Identifier = Digits = 0, Index = 0; Index < Length and
+		Digits < 2 * sizeof(Identifier); ++Index)
+		if (isxdigit(Buffer [Index]))
+			{
+			Identifier = Identifier << 4 | (isdigit(Buffer [Index]) ?
+				Buffer [Index] - '0' :
+				tolower(Buffer [Index]) - 'a' + 10);
+			++Digits;
+			}
+	return Identifier;
+	}
+
 }
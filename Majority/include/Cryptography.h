@@ -45,6 +45,32 @@
 //!	bytes.
 # define	ENCRYPTION_BLOCK_LENGTH			sizeof(std_ulong)
 
+//! \def	PARALLEL_BLOCKS
+//!	Number of blocks encrypted or decrypted together by the vector
+//!	implementation of the Feistel functions.
+# define	PARALLEL_BLOCKS				8
+
+//! \def	CRYPTOGRAPHY_BUFFER_BLOCKS
+//!	Number of blocks encrypted or decrypted together when reading or
+//!	writing files.
+# define	CRYPTOGRAPHY_BUFFER_BLOCKS		(8 * PARALLEL_BLOCKS)
+
+//! \def	AES_FEISTEL_STEPS
+//!	Number of Feistel steps of the AES engine.
+# define	AES_FEISTEL_STEPS			8
+
+//! \def	AES_STEP_KEYS
+//!	Number of AES round keys used by each Feistel step of the AES engine.
+# define	AES_STEP_KEYS				3
+
+//! \def	AES_BLOCK_LENGTH
+//!	Length of an AES block and of an AES round key in bytes.
+# define	AES_BLOCK_LENGTH			16
+
+//! \def	AES_ROUNDS
+//!	Number of rounds of AES with a key of ENCRYPTION_KEY_LENGTH bytes.
+# define	AES_ROUNDS				10
+
 namespace	utility_space
 {
 
@@ -56,6 +82,15 @@ static_assert(ENCRYPTION_KEY_LENGTH >=
 	"Wrong ENCRYPTION_KEY_LENGTH, less than WORD_FEISTEL_STEPS + "
 	"MULTIPLIER_OFFSET + sizeof(std_uint)");
 
+static_assert(ENCRYPTION_KEY_LENGTH % ENCRYPTION_BLOCK_LENGTH == 0,
+	"Wrong ENCRYPTION_KEY_LENGTH, non multiple of ENCRYPTION_BLOCK_LENGTH");
+
+static_assert(ENCRYPTION_KEY_LENGTH == AES_BLOCK_LENGTH,
+	"Wrong ENCRYPTION_KEY_LENGTH, not equal to AES_BLOCK_LENGTH");
+
+static_assert(AES_FEISTEL_STEPS % 2 == 0,
+	"Wrong AES_FEISTEL_STEPS, not even");
+
 ////////////////////////////////////////////////////////////////////////////////
 //! \class	Cryptography
 //!	The Cryptography class represents a cryptographycal device, used to
@@ -63,7 +98,17 @@ static_assert(ENCRYPTION_KEY_LENGTH >=
 //!
 //! \note
 //!	Encryption and decryption consider a single std_ulong at a time; the
-//!	result depends uniquely upon key and current value.
+//!	result depends uniquely upon key and current value. \n
+//!	Sequences of blocks can be encrypted and decrypted together, using
+//!	vector instructions, when the processor supports them. \n
+//!	Two cipher engines are available, the S-box Feistel network and a
+//!	Feistel network whose steps use AES rounds, besides a pass-through
+//!	engine used by elections created before encryption was enabled; the
+//!	engine must be selected before setting the key.
+//!
+//! \see	FEISTEL_ENGINE
+//! \see	AES_ENGINE
+//! \see	PLAIN_ENGINE
 //!
 ////////////////////////////////////////////////////////////////////////////////
 
@@ -75,6 +120,14 @@ class	Cryptography
 //!	Pointer to function used to implement a s-box.
 		typedef		byte		(*SBoxFunction)(byte Value);
 
+//! \property	Engine
+//!	Identifier of the cipher engine.
+//!
+//! \see	FEISTEL_ENGINE
+//! \see	AES_ENGINE
+//! \see	PLAIN_ENGINE
+				std_uint	Engine;
+
 //! \property	Key
 //!	Cryptographycal key.
 //!
@@ -105,6 +158,17 @@ class	Cryptography
 //! \see	WORD_FEISTEL_STEPS
 				byte		Constant [WORD_FEISTEL_STEPS];
 
+//! \property	AESKey
+//!	Round keys of the Feistel steps of the AES engine; they are derived from
+//!	the key, encrypting with AES a different counter for each of them.
+//!
+//! \see	AES_FEISTEL_STEPS
+//! \see	AES_STEP_KEYS
+//! \see	AES_BLOCK_LENGTH
+				byte		AESKey [AES_FEISTEL_STEPS]
+							[AES_STEP_KEYS]
+							[AES_BLOCK_LENGTH];
+
 //! \var	ModuleTable
 //!	Modules table.
 //!
@@ -185,6 +249,20 @@ class	Cryptography
 							[BYTE_FEISTEL_STEPS]
 							[sizeof(std_uint)];
 
+//! \var	FusedTable
+//!	Table of the S-box functions used in each Feistel step, composed with
+//!	bit diffusion, one array for each byte of a std_uint: element
+//!	[Step] [Byte] [Value] is equal to
+//!	DiffuseTable [Byte] [SubsFunctionTable [Step] [Byte] (Value)]. \n
+//!	It does not depend upon the key, so it is computed only once, when the
+//!	first Cryptography object is created.
+//!
+//! \see	BYTE_FEISTEL_STEPS
+//! \see	BYTE_MAX
+		static		std_uint	FusedTable [BYTE_FEISTEL_STEPS]
+							[sizeof(std_uint)]
+							[BYTE_MAX + 1];
+
 			void		MakeRotatedKey(void) noexcept;
 
 		static	byte		SBox_0(byte Value) noexcept;
@@ -206,11 +284,10 @@ class	Cryptography
 		static	std_uint	Diffuse(std_uint Source,
 						std_uint Destination) noexcept;
 
-		static	void		FeistelStep(std_uint ConstantSource,
-						std_uint& ModifiedSource,
-						std_uint LocalKey,
-						const SBoxFunction FunctionArray
-						[sizeof(std_uint)]) noexcept;
+		template<std_uint STEP>
+			void		FeistelStep(std_uint ConstantSource,
+						std_uint& ModifiedSource) const
+						noexcept;
 
 		static	void		FeistelStep(std_uint ConstantSource,
 						std_uint& ModifiedSource,
@@ -220,6 +297,74 @@ class	Cryptography
 						const SBoxFunction FunctionArray
 						[sizeof(std_uint)]) noexcept;
 
+		static	bool		FillFusedTable(void) noexcept;
+
+		static	void		MakeFusedTable(void) noexcept;
+
+		static	bool		IsParallelSupported(void) noexcept;
+
+		static	bool		IsAESSupported(void) noexcept;
+
+			void		MakeAESKey(const byte thisKey
+						[ENCRYPTION_KEY_LENGTH])
+						noexcept;
+
+			void		FeistelCrypt(const byte Plain
+						[ENCRYPTION_BLOCK_LENGTH],
+						byte Encrypted
+						[ENCRYPTION_BLOCK_LENGTH]) const
+						noexcept;
+
+			void		FeistelDecrypt(const byte Encrypted
+						[ENCRYPTION_BLOCK_LENGTH],
+						byte Plain
+						[ENCRYPTION_BLOCK_LENGTH]) const
+						noexcept;
+
+			void		AESCrypt(const byte Plain
+						[ENCRYPTION_BLOCK_LENGTH],
+						byte Encrypted
+						[ENCRYPTION_BLOCK_LENGTH]) const
+						noexcept;
+
+			void		AESDecrypt(const byte Encrypted
+						[ENCRYPTION_BLOCK_LENGTH],
+						byte Plain
+						[ENCRYPTION_BLOCK_LENGTH]) const
+						noexcept;
+
+			void		AESCryptParallel(const byte Plain
+						[PARALLEL_BLOCKS *
+						ENCRYPTION_BLOCK_LENGTH],
+						byte Encrypted
+						[PARALLEL_BLOCKS *
+						ENCRYPTION_BLOCK_LENGTH]) const
+						noexcept;
+
+			void		AESDecryptParallel(const byte
+						Encrypted [PARALLEL_BLOCKS *
+						ENCRYPTION_BLOCK_LENGTH],
+						byte Plain
+						[PARALLEL_BLOCKS *
+						ENCRYPTION_BLOCK_LENGTH]) const
+						noexcept;
+
+			void		CryptParallel(const byte Plain
+						[PARALLEL_BLOCKS *
+						ENCRYPTION_BLOCK_LENGTH],
+						byte Encrypted
+						[PARALLEL_BLOCKS *
+						ENCRYPTION_BLOCK_LENGTH]) const
+						noexcept;
+
+			void		DecryptParallel(const byte Encrypted
+						[PARALLEL_BLOCKS *
+						ENCRYPTION_BLOCK_LENGTH],
+						byte Plain
+						[PARALLEL_BLOCKS *
+						ENCRYPTION_BLOCK_LENGTH]) const
+						noexcept;
+
 	public:
 
 					Cryptography(void) noexcept;
@@ -239,6 +384,16 @@ class	Cryptography
 
 					~Cryptography(void) noexcept = default;
 
+			void		SetEngine(std_uint thisEngine)
+						throw(FatalException);
+
+			std_uint	GetEngine(void) const noexcept;
+
+		static	bool		IsEngineSupported(std_uint thisEngine)
+						noexcept;
+
+		static	std_uint	GetPreferredEngine(void) noexcept;
+
 			void		SetKey(const byte thisKey
 						[ENCRYPTION_KEY_LENGTH])
 						noexcept;
@@ -259,6 +414,14 @@ class	Cryptography
 						[ENCRYPTION_BLOCK_LENGTH]) const
 						noexcept;
 
+			void		CryptBlocks(const byte* Plain,
+						byte* Encrypted,
+						std_uint Blocks) const noexcept;
+
+			void		DecryptBlocks(const byte* Encrypted,
+						byte* Plain, std_uint Blocks)
+						const noexcept;
+
 		static	std_uint	ComputeBlocks(std_uint Bytes) noexcept;
 
 	};
@@ -269,4 +432,6 @@ class	Cryptography
 # include	"Cryptography.inl"
 # endif
 
+# include	"Cryptography.tpl"
+
 # endif
@@ -77,42 +77,6 @@ INLINE	std_uint	Cryptography::Diffuse(std_uint Source,
 	return Destination;
 	}
 
-////////////////////////////////////////////////////////////////////////////////
-//! \par	Description:
-//!	Execute a step of a Feistel function. \n
-//!	Part of the data is xor-ed with the key, then bytes are substituted by
-//!	different functions and the result scrambled, distributing bits of all
-//!	parts among all resulting bytes.
-//!
-//! \param	ConstantSource	The part of source data that is not changed.
-//! \param	ModifiedSource	Reference to the part of source data that is
-//!				changed.
-//! \param	LocalKey	Key used to xor the modified source data.
-//! \param	FunctionArray	Array of pointers to functions implementing the
-//!				S-box, one for each byte.
-//!
-//! \throw	None.
-//!
-//! \returns	None
-//!
-////////////////////////////////////////////////////////////////////////////////
-
-INLINE	void	Cryptography::FeistelStep(std_uint ConstantSource,
-			std_uint& ModifiedSource, std_uint LocalKey,
-			const SBoxFunction FunctionArray [sizeof(std_uint)])
-			noexcept
-	{
-	ConstantSource ^= LocalKey;
-	ModifiedSource =
-		Diffuse(FunctionArray [0] (static_cast<byte>(ConstantSource)) |
-		(FunctionArray [1] (static_cast<byte>(ConstantSource >>
-		CHAR_BIT)) << CHAR_BIT) |
-		(FunctionArray [2] (static_cast<byte>(ConstantSource >>
-		(2 * CHAR_BIT))) << (2 * CHAR_BIT)) |
-		(FunctionArray [3] (static_cast<byte>(ConstantSource >>
-		(3 * CHAR_BIT))) << (3 * CHAR_BIT)), ModifiedSource);
-	}
-
 ////////////////////////////////////////////////////////////////////////////////
 //! \par	Description:
 //!	Execute a step of a Feistel function. \n
@@ -156,23 +120,79 @@ INLINE	void	Cryptography::FeistelStep(std_uint ConstantSource,
 
 ////////////////////////////////////////////////////////////////////////////////
 //! \par	Description:
-//!	Default constructor; initialize the device with a zero key.
+//!	Default constructor; initialize the device with the original Feistel
+//!	engine and a zero key.
 //!
 //! \throw	None.
 //!
 //! \returns	Not applicable.
 //!
+//! \note
+//!	The first time a Cryptography object is created, it computes the
+//!	FusedTable.
+//!
 ////////////////////////////////////////////////////////////////////////////////
 
-INLINE	Cryptography::Cryptography(void) noexcept: Key(), RotatedKey(),
-		Multiplier(), Constant()
+INLINE	Cryptography::Cryptography(void) noexcept: Engine(FEISTEL_ENGINE),
+		Key(), RotatedKey(), Multiplier(), Constant(), AESKey()
 	{
+	MakeFusedTable();
 	ignore_value(memset(Key, DEFAULT_KEY, sizeof(Key)));
 	}
 
 ////////////////////////////////////////////////////////////////////////////////
 //! \par	Description:
-//!	Set the encryption key.
+//!	Select the cipher engine.
+//!
+//! \param	thisEngine			Identifier of the engine.
+//!
+//! \throw	utility_space::ILLEGAL_ARGUMENT	If the engine is not valid or it
+//!						is not supported by the
+//!						processor.
+//!
+//! \returns	None.
+//!
+//! \note
+//!	The key must be set after selecting the engine.
+//!
+//! \see	FEISTEL_ENGINE
+//! \see	AES_ENGINE
+//! \see	PLAIN_ENGINE
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+INLINE	void	Cryptography::SetEngine(std_uint thisEngine)
+			throw(FatalException)
+	{
+	if (not IsEngineSupported(thisEngine))
+		throw make_fatal_exception(ILLEGAL_ARGUMENT);
+	Engine = thisEngine;
+	}
+
+////////////////////////////////////////////////////////////////////////////////
+//! \par	Description:
+//!	Get the identifier of the cipher engine.
+//!
+//! \throw	None.
+//!
+//! \returns	std_uint	The identifier of the engine.
+//!
+//! \see	FEISTEL_ENGINE
+//! \see	AES_ENGINE
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+INLINE	std_uint	Cryptography::GetEngine(void) const noexcept
+	{
+	return Engine;
+	}
+
+////////////////////////////////////////////////////////////////////////////////
+//! \par	Description:
+//!	Set the encryption key. \n
+//!	For the original Feistel engine the key actually used is the given key,
+//!	encrypted with itself; for the AES engine the round keys are derived
+//!	from the given key; the pass-through engine does not use the key.
 //!
 //! \param	thisKey	The encryption key.
 //!
@@ -181,17 +201,28 @@ INLINE	Cryptography::Cryptography(void) noexcept: Key(), RotatedKey(),
 //! \returns	None.
 //!
 //! \see	ENCRYPTION_KEY_LENGTH
+//! \see	ENCRYPTION_BLOCK_LENGTH
 //!
 ////////////////////////////////////////////////////////////////////////////////
 
 INLINE	void	Cryptography::SetKey(const byte thisKey [ENCRYPTION_KEY_LENGTH])
 			noexcept
 	{
-	byte	LocalKey [ENCRYPTION_KEY_LENGTH];
+	register	std_uint	Index;
+			byte		LocalKey [ENCRYPTION_KEY_LENGTH];
 
 	ignore_value(memcpy(Key, thisKey, sizeof(Key)));
+	if (Engine == PLAIN_ENGINE)
+		return;
+	if (Engine == AES_ENGINE)
+		{
+		MakeAESKey(thisKey);
+		return;
+		}
 	MakeRotatedKey();
-	Crypt(Key, LocalKey);
+	for (Index = 0; Index < ENCRYPTION_KEY_LENGTH; Index +=
+		ENCRYPTION_BLOCK_LENGTH)
+		Crypt(Key + Index, LocalKey + Index);
 	ignore_value(memcpy(Key, LocalKey, sizeof(Key)));
 	MakeRotatedKey();
 	}
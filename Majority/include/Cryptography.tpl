@@ -0,0 +1,62 @@
+////////////////////////////////////////////////////////////////////////////////
+//! \file
+//!
+//! \author	agent
+//!
+//! \date	16/10/2026
+//!
+//! \par	Function:
+//!	Contains the implementation of the template functions of the
+//!	utility_space::Cryptography class.
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+namespace	utility_space
+{
+
+////////////////////////////////////////////////////////////////////////////////
+//! \par	Description:
+//!	Execute a step of a Feistel function. \n
+//!	Part of the data is xor-ed with the key, then bytes are substituted by
+//!	different functions and the result scrambled, distributing bits of all
+//!	parts among all resulting bytes. \n
+//!	Substitution and scrambling are performed together, by looking up the
+//!	FusedTable of the step.
+//!
+//! \tparam	STEP		Template parameter STEP is the index of the
+//!				Feistel step, which selects the key and the
+//!				S-box functions.
+//!
+//! \param	ConstantSource	The part of source data that is not changed.
+//! \param	ModifiedSource	Reference to the part of source data that is
+//!				changed.
+//!
+//! \throw	None.
+//!
+//! \returns	None
+//!
+//! \see	BYTE_FEISTEL_STEPS
+//! \see	BYTE_BITS
+//! \see	BYTE_MAX
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+template<std_uint STEP>
+	INLINE	void	Cryptography::FeistelStep(std_uint ConstantSource,
+				std_uint& ModifiedSource) const noexcept
+		{
+		static_assert(STEP < BYTE_FEISTEL_STEPS,
+			"Wrong STEP, not less than BYTE_FEISTEL_STEPS");
+
+		ConstantSource ^= RotatedKey [STEP];
+		ModifiedSource ^=
+			FusedTable [STEP] [0] [ConstantSource % (BYTE_MAX + 1)] ^
+			FusedTable [STEP] [1] [(ConstantSource >> BYTE_BITS) %
+			(BYTE_MAX + 1)] ^
+			FusedTable [STEP] [2] [(ConstantSource >>
+			(2 * BYTE_BITS)) % (BYTE_MAX + 1)] ^
+			FusedTable [STEP] [3] [(ConstantSource >>
+			(3 * BYTE_BITS)) % (BYTE_MAX + 1)];
+		}
+
+}
@@ -0,0 +1,179 @@
+////////////////////////////////////////////////////////////////////////////////
+//! \file
+//!
+//! \author	agent
+//!
+//! \date	16/10/2026
+//!
+//! \par	Function:
+//!	It contains the declaration of the utility_space::ElectionTally class.
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+# if !defined	ELECTION_TALLY_H
+
+# define	ELECTION_TALLY_H
+
+# include	<string.h>	// Defines memcpy() used in .tpl
+
+# include	"Parameter.h"
+# include	"FatalException.h"
+# include	"ApplicationException.h"
+# include	"Vector.h"
+
+//! \def	BYTE_LANES
+//!	A std_ulong with all the bytes equal to 1; multiplying it by a byte
+//!	value gives a std_ulong with all the bytes equal to the value.
+# define	BYTE_LANES		(~static_cast<std_ulong>(0) / BYTE_MAX)
+
+namespace	utility_space
+{
+
+using	namespace	data_structure_space;
+using	namespace	application_space;
+
+static_assert(((MAXIMUM_VOTE + 1) & MAXIMUM_VOTE) == 0,
+	"Wrong MAXIMUM_VOTE, MAXIMUM_VOTE + 1 not a power of 2");
+
+static_assert(MAXIMUM_VOTE < BYTE_MAX / 2,
+	"Wrong MAXIMUM_VOTE, not less than half a byte");
+
+////////////////////////////////////////////////////////////////////////////////
+//! \class	ElectionTally
+//!	The ElectionTally class contains the numbers of votes of all the
+//!	candidates of an election.
+//!
+//! \note
+//!	The counters are stored in a single array, candidate by candidate, so
+//!	that counting a ballot touches one contiguous block of memory and
+//!	adding two tallies is a single loop over the array, which the compiler
+//!	can vectorize.
+//!
+//! \note
+//!	The votes of a voter are counted directly from their encoded form in
+//!	the votes file, by a function specialized for the maximum vote, that
+//!	checks all the bytes of a std_ulong at once.
+//!
+//! \note
+//!	The candidates are sorted by a radix sort on a key packing the lower
+//!	extreme and as many counters as fit into a std_ulong, in the order in
+//!	which they are compared; only candidates with equal keys are compared
+//!	counter by counter.
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+class	ElectionTally
+	{
+	private:
+
+//! \typedef	CountFunctionType
+//!	Pointer to a function counting the encoded votes of a voter.
+		typedef		bool		(ElectionTally::*CountFunctionType)(
+							const byte* Votes);
+
+//! \property	Candidates
+//!	Number of candidates.
+		std_uint		Candidates;
+
+//! \property	Values
+//!	Number of possible votes, that is, the maximum vote + 1.
+		std_uint		Values;
+
+//! \property	Counters
+//!	Vector containing the number of votes; the counter of vote v of
+//!	candidate c has index c * Values + v.
+		Vector<std_uint>	Counters;
+
+//! \property	LowerExtremes
+//!	Vector containing the lower extreme of a fraction of the votes of each
+//!	candidate.
+		Vector<std_uint>	LowerExtremes;
+
+//! \property	CountFunction
+//!	Function counting the encoded votes of a voter, specialized for the
+//!	maximum vote.
+		CountFunctionType	CountFunction;
+
+//! \property	CountFunctions
+//!	Array containing the functions counting the encoded votes of a voter;
+//!	the element with index i is specialized for maximum vote i + 1.
+	static	const	CountFunctionType	CountFunctions [MAXIMUM_VOTE];
+
+		template<std_uint MAXIMUM>
+			bool	CountEncoded(register const byte* Votes)
+					throw(ApplicationException);
+
+		bool		IsGreater(std_uint Candidate1,
+					std_uint Candidate2) const noexcept;
+
+		bool		Precedes(std_uint Candidate1,
+					std_uint Candidate2) const noexcept;
+
+		std_ulong	GetSortKey(std_uint Candidate,
+					std_uint CounterBits, std_uint Fields,
+					std_uint MaximumCounter) const noexcept;
+
+		void		SortRange(register std_uint* Index,
+					std_uint Size) const noexcept;
+
+	public:
+
+				ElectionTally(void) throw(FatalException);
+
+				ElectionTally(std_uint thisCandidates,
+					std_uint MaximumVote)
+					throw(FatalException);
+
+				ElectionTally(const ElectionTally& Argument)
+					throw(FatalException) = default;
+
+				ElectionTally(ElectionTally&& Argument)
+					throw(FatalException) = default;
+
+		ElectionTally&	operator = (const ElectionTally& Argument)
+					throw(FatalException) = default;
+
+		ElectionTally&	operator = (ElectionTally&& Argument)
+					throw(FatalException) = default;
+
+				~ElectionTally(void) noexcept;
+
+		ElectionTally&	operator += (register const ElectionTally&
+					Operand) noexcept;
+
+		std_uint	GetCandidates(void) const noexcept;
+
+		std_uint	GetMaximumVote(void) const noexcept;
+
+		std_uint	GetLowerExtreme(std_uint Candidate) const
+					throw(FatalException);
+
+		std_uint	GetCounter(std_uint Candidate, std_uint Vote)
+					const throw(FatalException);
+
+		bool		IsEqual(std_uint Candidate1,
+					std_uint Candidate2) const
+					throw(FatalException);
+
+		bool		Count(const byte* Votes)
+					throw(ApplicationException);
+
+		bool		Uncount(register const byte* Votes)
+					noexcept;
+
+		void		ComputeLowerExtremes(std_uint Votes) noexcept;
+
+		void		SortCandidates(register Vector<std_uint>&
+					OrderedIndex) const
+					throw(FatalException);
+	};
+
+}
+
+# if defined	USE_INLINE
+# include	"ElectionTally.inl"
+# endif
+
+# include	"ElectionTally.tpl"
+
+# endif
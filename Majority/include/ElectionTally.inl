@@ -0,0 +1,467 @@
+////////////////////////////////////////////////////////////////////////////////
+//! \file
+//!
+//! \author	agent
+//!
+//! \date	16/10/2026
+//!
+//! \par	Function:
+//!	It contains the definitions of inline functions of the
+//!	utility_space::ElectionTally class.
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+namespace	utility_space
+{
+
+using	namespace	data_structure_space;
+
+////////////////////////////////////////////////////////////////////////////////
+//! \par	Description:
+//!	Check if the votes of a candidate are greater than the votes of another
+//!	one, that is, if the first candidate has a greater lower extreme or, if
+//!	the lower extremes are equal, if it has more votes not greater than the
+//!	lower extreme or less votes greater than it, starting from the votes
+//!	nearest to the lower extreme.
+//!
+//! \param	Candidate1	Index of the first candidate.
+//! \param	Candidate2	Index of the second candidate.
+//!
+//! \throw	None.
+//!
+//! \returns	bool		True if the votes of the first candidate are
+//!				greater, false otherwise.
+//!
+//! \note
+//!	If the lower extremes have not been computed, the returned value is
+//!	unpredictable.
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+INLINE	bool	ElectionTally::IsGreater(std_uint Candidate1,
+			std_uint Candidate2) const noexcept
+	{
+	register	const	std_uint*	Counter1;
+	register	const	std_uint*	Counter2;
+	register		std_uint	Extreme;
+	register		std_uint	Index;
+
+	Extreme = LowerExtremes [Candidate1];
+	if (Extreme != LowerExtremes [Candidate2])
+		return Extreme > LowerExtremes [Candidate2];
+	Counter1 = &Counters [Candidate1 * Values];
+	Counter2 = &Counters [Candidate2 * Values];
+	if (Extreme >= Values)
+		Extreme = Values - 1;
+	for (Index = Extreme;; --Index)
+		{
+		if (Counter1 [Index] != Counter2 [Index])
+			return Counter1 [Index] > Counter2 [Index];
+		if (Index == 0)
+			break;
+		}
+	for (Index = Extreme + 1; Index < Values; ++Index)
+		if (Counter1 [Index] != Counter2 [Index])
+			return Counter1 [Index] < Counter2 [Index];
+	return false;
+	}
+
+////////////////////////////////////////////////////////////////////////////////
+//! \par	Description:
+//!	Check if a candidate precedes another one in increasing order of votes;
+//!	candidates with equal votes are in decreasing order of index.
+//!
+//! \param	Candidate1	Index of the first candidate.
+//! \param	Candidate2	Index of the second candidate.
+//!
+//! \throw	None.
+//!
+//! \returns	bool		True if the first candidate precedes the second
+//!				one, false otherwise.
+//!
+//! \see	IsGreater
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+INLINE	bool	ElectionTally::Precedes(std_uint Candidate1,
+			std_uint Candidate2) const noexcept
+	{
+	if (IsGreater(Candidate2, Candidate1))
+		return true;
+	return Candidate1 > Candidate2 and
+		not IsGreater(Candidate1, Candidate2);
+	}
+
+////////////////////////////////////////////////////////////////////////////////
+//! \par	Description:
+//!	Compute the sort key of a candidate, containing the lower extreme in
+//!	the highest bits, followed by the counters of the votes not greater
+//!	than the lower extreme, starting from the nearest one, and by the
+//!	complements of the counters of the votes greater than it, each in
+//!	CounterBits bits; a candidate with greater votes has a key not less
+//!	than the key of the other one.
+//!
+//! \param	Candidate	Index of the candidate.
+//! \param	CounterBits	Number of bits of each counter.
+//! \param	Fields		Number of counters in the key.
+//! \param	MaximumCounter	Maximum counter of all the candidates.
+//!
+//! \throw	None.
+//!
+//! \returns	std_ulong	The sort key.
+//!
+//! \note
+//!	The lower extreme and Fields counters of CounterBits bits must fit
+//!	into a std_ulong, otherwise the key is truncated.
+//!
+//! \see	IsGreater
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+INLINE	std_ulong	ElectionTally::GetSortKey(std_uint Candidate,
+				std_uint CounterBits, std_uint Fields,
+				std_uint MaximumCounter) const noexcept
+	{
+	register	const	std_uint*	Counter;
+	register		std_ulong	Key;
+	register		std_uint	Extreme;
+	register		std_uint	Field;
+
+	Counter = &Counters [Candidate * Values];
+	Key = LowerExtremes [Candidate];
+	if ((Extreme = LowerExtremes [Candidate]) >= Values)
+		Extreme = Values - 1;
+	for (Field = 0; Field < Fields; ++Field)
+		{
+		Key <<= CounterBits;
+		if (Field <= Extreme)
+			Key |= Counter [Extreme - Field];
+		else
+			Key |= MaximumCounter - Counter [Field];
+		}
+	return Key;
+	}
+
+////////////////////////////////////////////////////////////////////////////////
+//! \par	Description:
+//!	Default constructor.
+//!
+//! \throw	utility_space::OUT_OF_MEMORY	If memory allocation fails.
+//!
+//! \returns	Not applicable.
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+INLINE	ElectionTally::ElectionTally(void) throw(FatalException):
+		Candidates(0), Values(0), Counters(), LowerExtremes(),
+		CountFunction(nullptr)
+	{
+	}
+
+////////////////////////////////////////////////////////////////////////////////
+//! \par	Description:
+//!	Constructor; construct an ElectionTally with a given number of
+//!	candidates and of votes, that is, MaximumVote + 1, with all the
+//!	counters equal to zero.
+//!
+//! \param	thisCandidates			Number of candidates.
+//! \param	MaximumVote			Maximum possible vote.
+//!
+//! \throw	utility_space::OUT_OF_MEMORY	If memory allocation fails.
+//! \throw	utility_space::ILLEGAL_ARGUMENT	If the maximum vote is zero or
+//!						greater than MAXIMUM_VOTE.
+//!
+//! \returns	Not applicable.
+//!
+//! \see	MAXIMUM_VOTE
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+INLINE	ElectionTally::ElectionTally(std_uint thisCandidates,
+		std_uint MaximumVote) throw(FatalException):
+		Candidates(thisCandidates), Values(MaximumVote + 1),
+		Counters(thisCandidates * (MaximumVote + 1)),
+		LowerExtremes(thisCandidates), CountFunction(nullptr)
+	{
+	if (MaximumVote == 0 or MaximumVote > MAXIMUM_VOTE)
+		throw make_fatal_exception(ILLEGAL_ARGUMENT);
+	CountFunction = CountFunctions [MaximumVote - 1];
+	Counters.Append(0, Candidates * Values);
+	LowerExtremes.Append(0, Candidates);
+	}
+
+////////////////////////////////////////////////////////////////////////////////
+//! \par	Description:
+//!	Destructor
+//!
+//! \throw	None.
+//!
+//! \returns	Not applicable.
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+INLINE	ElectionTally::~ElectionTally(void) noexcept
+	{
+	}
+
+////////////////////////////////////////////////////////////////////////////////
+//! \par	Description:
+//!	Add the counters of the given ElectionTally object to the counters of
+//!	current object.
+//!
+//! \param	Operand		Reference to the ElectionTally to add.
+//!
+//! \throw	None.
+//!
+//! \returns	ElectionTally&	Reference to current object.
+//!
+//! \note
+//!	If the number of candidates or of possible votes is not the same for
+//!	both ojects, the behaviour is unpredictable.
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+INLINE	ElectionTally&	ElectionTally::operator += (register const
+				ElectionTally& Operand) noexcept
+	{
+	register		std_uint*	Counter;
+	register	const	std_uint*	Addend;
+	register		std_uint	Index;
+	register		std_uint	Size;
+
+	assert(Candidates == Operand.Candidates and Values == Operand.Values);
+	if ((Size = Counters.GetPresent()) == 0)
+		return *this;
+	Counter = &Counters [0];
+	Addend = &Operand.Counters [0];
+	for (Index = 0; Index < Size; ++Index)
+		Counter [Index] += Addend [Index];
+	return *this;
+	}
+
+////////////////////////////////////////////////////////////////////////////////
+//! \par	Description:
+//!	Get the number of candidates.
+//!
+//! \throw	None.
+//!
+//! \returns	std_uint	The number of candidates.
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+INLINE	std_uint	ElectionTally::GetCandidates(void) const noexcept
+	{
+	return Candidates;
+	}
+
+////////////////////////////////////////////////////////////////////////////////
+//! \par	Description:
+//!	Get the maximum possible vote.
+//!
+//! \throw	None.
+//!
+//! \returns	std_uint	The maximum vote.
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+INLINE	std_uint	ElectionTally::GetMaximumVote(void) const noexcept
+	{
+	return Values - 1;
+	}
+
+////////////////////////////////////////////////////////////////////////////////
+//! \par	Description:
+//!	Get the latest computed lower extreme of a fraction of the votes of a
+//!	candidate.
+//!
+//! \param	Candidate				Index of the candidate.
+//!
+//! \throw	utility_space::INDEX_OUT_OF_BOUNDS	If the candidate does
+//!							not exist.
+//!
+//! \returns	std_uint				The lower extreme.
+//!
+//! \note
+//!	If the lower extreme was never computed, the function returns zero.
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+INLINE	std_uint	ElectionTally::GetLowerExtreme(std_uint Candidate) const
+				throw(FatalException)
+	{
+	return LowerExtremes [Candidate];
+	}
+
+////////////////////////////////////////////////////////////////////////////////
+//! \par	Description:
+//!	Get the counter of a vote of a candidate.
+//!
+//! \param	Candidate				Index of the candidate.
+//! \param	Vote					The vote.
+//!
+//! \throw	utility_space::INDEX_OUT_OF_BOUNDS	If the candidate does
+//!							not exist or if vote is
+//!							greater than the maximum
+//!							vote.
+//!
+//! \returns	std_uint				The counter of the vote.
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+INLINE	std_uint	ElectionTally::GetCounter(std_uint Candidate,
+				std_uint Vote) const throw(FatalException)
+	{
+	if (Vote >= Values)
+		throw make_fatal_exception(INDEX_OUT_OF_BOUNDS);
+	return Counters [Candidate * Values + Vote];
+	}
+
+////////////////////////////////////////////////////////////////////////////////
+//! \par	Description:
+//!	Check if two candidates have the same votes.
+//!
+//! \param	Candidate1				Index of the first
+//!							candidate.
+//! \param	Candidate2				Index of the second
+//!							candidate.
+//!
+//! \throw	utility_space::INDEX_OUT_OF_BOUNDS	If a candidate does not
+//!							exist.
+//!
+//! \returns	bool					True if the counters of
+//!							all the votes are equal,
+//!							false otherwise.
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+INLINE	bool	ElectionTally::IsEqual(std_uint Candidate1,
+			std_uint Candidate2) const throw(FatalException)
+	{
+	register	const	std_uint*	Counter1;
+	register	const	std_uint*	Counter2;
+	register		std_uint	Index;
+
+	Counter1 = &Counters [Candidate1 * Values];
+	Counter2 = &Counters [Candidate2 * Values];
+	for (Index = 0; Index < Values; ++Index)
+		if (Counter1 [Index] != Counter2 [Index])
+			return false;
+	return true;
+	}
+
+////////////////////////////////////////////////////////////////////////////////
+//! \par	Description:
+//!	Count the votes of a voter, encoded as in the votes file, unless they
+//!	are all zero, that is, unless the voter has not voted.
+//!
+//! \param	Votes					Pointer to the decrypted
+//!							votes of the voter, one
+//!							byte for each candidate,
+//!							padded with zero votes
+//!							to a multiple of
+//!							sizeof(std_ulong) bytes.
+//!
+//! \throw	application_space::CORRUPTED_VOTES_FILE	If a vote is greater
+//!							than the maximum vote or
+//!							a padding vote is not
+//!							zero.
+//!
+//! \returns	bool					True if the votes have
+//!							been counted, false if
+//!							they are all zero.
+//!
+//! \note
+//!	If the object has been created by the default constructor, the
+//!	behaviour is unpredictable.
+//!
+//! \see	CountEncoded
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+INLINE	bool	ElectionTally::Count(const byte* Votes)
+			throw(ApplicationException)
+	{
+	assert(CountFunction != nullptr);
+	return (this->*CountFunction)(Votes);
+	}
+
+////////////////////////////////////////////////////////////////////////////////
+//! \par	Description:
+//!	Remove the votes of a voter, encoded as in the votes file, previously
+//!	counted by Count, unless they are all zero, that is, unless the voter
+//!	has not voted.
+//!
+//! \param	Votes		Pointer to the decrypted votes of the voter, one
+//!				byte for each candidate.
+//!
+//! \throw	None.
+//!
+//! \returns	bool		True if the votes have been removed, false if
+//!				they are all zero.
+//!
+//! \note
+//!	If the votes have not been counted, the behaviour is unpredictable.
+//!
+//! \see	Count
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+INLINE	bool	ElectionTally::Uncount(register const byte* Votes) noexcept
+	{
+	register	std_uint*	Counter;
+	register	std_uint	Index;
+
+	for (Index = 0; Index < Candidates; ++Index)
+		if (Votes [Index] % (MAXIMUM_VOTE + 1) != 0)
+			break;
+	if (Index == Candidates)
+		return false;
+	Counter = &Counters [0];
+	for (Index = 0; Index < Candidates; ++Index)
+		{
+		--Counter [Votes [Index] % (MAXIMUM_VOTE + 1)];
+		Counter += Values;
+		}
+	return true;
+	}
+
+////////////////////////////////////////////////////////////////////////////////
+//! \par	Description:
+//!	Compute the lower extreme of a given fraction of the votes of each
+//!	candidate and store it into LowerExtremes.
+//!
+//! \param	Votes	The number of votes required to get the lower extreme.
+//!
+//! \throw	None.
+//!
+//! \returns	None.
+//!
+//! \note
+//!	If the given number of votes cannot be reached, the lower extreme is
+//!	the number of different votes, that is, Values, otherwise it is the
+//!	lowest vote that satisfies the requirement.
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+INLINE	void	ElectionTally::ComputeLowerExtremes(std_uint Votes) noexcept
+	{
+	register	const	std_uint*	Counter;
+	register		std_uint	Candidate;
+	register		std_uint	Index;
+	register		std_uint	Sum;
+
+	if (Candidates == 0)
+		return;
+	Counter = &Counters [0];
+	for (Candidate = 0; Candidate < Candidates; ++Candidate)
+		{
+		Sum = 0;
+		for (Index = 0; Index < Values; ++Index)
+			if ((Sum += Counter [Index]) >= Votes)
+				break;
+		LowerExtremes [Candidate] = Index;
+		Counter += Values;
+		}
+	}
+
+}
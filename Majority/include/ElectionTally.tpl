@@ -0,0 +1,94 @@
+////////////////////////////////////////////////////////////////////////////////
+//! \file
+//!
+//! \author	agent
+//!
+//! \date	16/10/2026
+//!
+//! \par	Function:
+//!	Contains the implementation of the template functions of the
+//!	utility_space::ElectionTally class.
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+namespace	utility_space
+{
+
+////////////////////////////////////////////////////////////////////////////////
+//! \par	Description:
+//!	Count the votes of a voter, encoded as in the votes file, unless they
+//!	are all zero, that is, unless the voter has not voted. \n
+//!	The votes are checked a std_ulong at a time: the fillers are removed
+//!	from all the bytes with a mask and a vote greater than the maximum one
+//!	sets the highest bit of its byte when the complement of the maximum to
+//!	the highest bit is added to all the bytes.
+//!
+//! \tparam	MAXIMUM		Template parameter MAXIMUM is the maximum
+//!				possible vote.
+//!
+//! \param	Votes					Pointer to the decrypted
+//!							votes of the voter, one
+//!							byte for each candidate,
+//!							padded with zero votes
+//!							to a multiple of
+//!							sizeof(std_ulong) bytes.
+//!
+//! \throw	application_space::CORRUPTED_VOTES_FILE	If a vote is greater
+//!							than MAXIMUM or a
+//!							padding vote is not
+//!							zero.
+//!
+//! \returns	bool					True if the votes have
+//!							been counted, false if
+//!							they are all zero.
+//!
+//! \see	MAXIMUM_VOTE
+//! \see	BYTE_LANES
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+template<std_uint MAXIMUM>
+	bool	ElectionTally::CountEncoded(register const byte* Votes)
+			throw(ApplicationException)
+		{
+		register	std_uint*	Counter;
+		register	std_ulong	Word;
+		register	std_ulong	Voted;
+		register	std_uint	Index;
+		register	std_uint	Words;
+
+		static_assert(MAXIMUM > 0 and MAXIMUM <= MAXIMUM_VOTE,
+			"Wrong MAXIMUM, outside the range of the votes");
+
+		assert(MAXIMUM + 1 == Values);
+		Words = (Candidates + sizeof(std_ulong) - 1) /
+			sizeof(std_ulong);
+		Voted = 0;
+		for (Index = 0; Index < Words; ++Index)
+			{
+			memcpy(&Word, Votes + Index * sizeof(std_ulong),
+				sizeof(std_ulong));
+			Word &= BYTE_LANES * MAXIMUM_VOTE;
+			if (((Word + BYTE_LANES * (BYTE_MAX / 2 - MAXIMUM)) &
+				BYTE_LANES * (BYTE_MAX / 2 + 1)) != 0)
+				throw make_application_exception(
+					CORRUPTED_VOTES_FILE);
+			Voted |= Word;
+			}
+		for (Index = Candidates; Index < Words * sizeof(std_ulong);
+			++Index)
+			if (Votes [Index] % (MAXIMUM_VOTE + 1) != 0)
+				throw make_application_exception(
+					CORRUPTED_VOTES_FILE);
+		if (Voted == 0)
+			return false;
+		Counter = &Counters [0];
+		for (Index = 0; Index < Candidates; ++Index)
+			{
+			++Counter [Votes [Index] % (MAXIMUM_VOTE + 1)];
+			Counter += MAXIMUM + 1;
+			}
+		return true;
+		}
+
+}
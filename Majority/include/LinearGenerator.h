@@ -71,6 +71,32 @@ class	LinearGenerator
 //!	Latest generated value.
 		std_uint		Value;
 
+//! \property	ModuleReciprocal
+//!	Reciprocal of Module, scaled by 2 ^ 64, used to compute remainders
+//!	without divisions.
+		std_ulong		ModuleReciprocal;
+
+//! \property	RangeMaximum
+//!	Maximum used in the latest call of Generate, or zero.
+		std_uint		RangeMaximum;
+
+//! \property	RangeLimit
+//!	Maximum value accepted by Generate for RangeMaximum.
+		std_uint		RangeLimit;
+
+//! \property	RangeReciprocal
+//!	Reciprocal of RangeMaximum + 1, scaled by 2 ^ 64, used to compute
+//!	remainders without divisions.
+		std_ulong		RangeReciprocal;
+
+		static	std_ulong	MultiplyHigh(std_ulong First,
+						std_ulong Second) noexcept;
+
+		std_uint		Reduce(std_ulong Dividend) const
+						noexcept;
+
+		void			SetRange(std_uint Maximum) noexcept;
+
 	public:
 
 					LinearGenerator(void) noexcept;
@@ -97,9 +123,16 @@ class	LinearGenerator
 
 		void			SetSeed(std_uint Seed) noexcept;
 
+		std_uint		GetSeed(void) const noexcept;
+
+		void			Skip(std_ulong Steps) noexcept;
+
 		std_uint		Generate(std_uint Maximum)
 						throw(FatalException);
 
+		std_uint		GenerateUnchecked(std_uint Maximum)
+						noexcept;
+
 	};
 
 }
@@ -14,6 +14,91 @@
 namespace	utility_space
 {
 
+////////////////////////////////////////////////////////////////////////////////
+//! \par	Description:
+//!	Compute the most significant half of the product of two numbers.
+//!
+//! \param	First		First factor.
+//! \param	Second		Second factor.
+//!
+//! \throw	None.
+//!
+//! \returns	std_ulong	The product, divided by 2 ^ 64.
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+INLINE	std_ulong	LinearGenerator::MultiplyHigh(std_ulong First,
+				std_ulong Second) noexcept
+	{
+# if COMPILER == GNU_4
+	return static_cast<std_ulong>((static_cast<unsigned __int128>(First) *
+		static_cast<unsigned __int128>(Second)) >> 64);
+# else
+	register	std_ulong	Middle;
+
+	Middle = (First & 0xFFFFFFFF) * (Second >> 32) +
+		((First & 0xFFFFFFFF) * (Second & 0xFFFFFFFF) >> 32);
+	return (First >> 32) * (Second >> 32) + (Middle >> 32) +
+		(((First >> 32) * (Second & 0xFFFFFFFF) + (Middle & 0xFFFFFFFF)) >>
+		32);
+# endif
+	}
+
+////////////////////////////////////////////////////////////////////////////////
+//! \par	Description:
+//!	Compute the remainder of the division of a number by Module, without
+//!	divisions.
+//!
+//! \param	Dividend	The number.
+//!
+//! \throw	None.
+//!
+//! \returns	std_uint	Dividend % Module.
+//!
+//! \note
+//!	Barrett reduction: ModuleReciprocal is (2 ^ 64 - 1) / Module, so that
+//!	the estimated quotient is either exact or smaller by one and at most a
+//!	single correction is needed.
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+INLINE	std_uint	LinearGenerator::Reduce(std_ulong Dividend) const
+				noexcept
+	{
+	Dividend -= MultiplyHigh(Dividend, ModuleReciprocal) * Module;
+	if (Dividend >= Module)
+		Dividend -= Module;
+	return static_cast<std_uint>(Dividend);
+	}
+
+////////////////////////////////////////////////////////////////////////////////
+//! \par	Description:
+//!	Compute the data used by Generate for a given maximum.
+//!
+//! \param	Maximum		The maximum number that can be generated; it
+//!				must be greater than zero.
+//!
+//! \throw	None.
+//!
+//! \returns	None.
+//!
+//! \note
+//!	RangeReciprocal is 2 ^ 64 / (Maximum + 1), rounded up, so that the
+//!	remainder of the division of any std_uint by Maximum + 1 is the most
+//!	significant half of the product of Maximum + 1 and the less significant
+//!	half of the product of RangeReciprocal and the number (D. Lemire, O.
+//!	Kaser, N. Kurz, Faster Remainder by Direct Computation, 2019).
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+INLINE	void	LinearGenerator::SetRange(std_uint Maximum) noexcept
+	{
+	RangeMaximum = Maximum;
+	RangeLimit = Module - Module % Maximum;
+	RangeReciprocal = STD_ULONG_MAX / (static_cast<std_ulong>(Maximum) + 1) +
+		1;
+	}
+
 ////////////////////////////////////////////////////////////////////////////////
 //! \par	Description:
 //!	Default constructor
@@ -30,7 +115,9 @@ namespace	utility_space
 
 INLINE	LinearGenerator::LinearGenerator(void) noexcept:
 		Multiplier(DEFAULT_MULTIPLIER), Constant(DEFAULT_CONSTANT),
-		Module(DEFAULT_MODULE), Value(0)
+		Module(DEFAULT_MODULE), Value(0),
+		ModuleReciprocal(STD_ULONG_MAX / DEFAULT_MODULE), RangeMaximum(0),
+		RangeLimit(0), RangeReciprocal(0)
 	{
 	}
 
@@ -54,11 +141,13 @@ INLINE	void	LinearGenerator::SetParameters(std_uint thisMultiplier,
 			std_uint thisConstant, std_uint thisModule)
 			throw(FatalException)
 	{
-	if (Multiplier == 0 or Module == 0)
+	if (thisMultiplier == 0 or thisModule == 0)
 		throw make_fatal_exception(ILLEGAL_ARGUMENT);
 	Multiplier = thisMultiplier;
 	Constant = thisConstant;
 	Module = thisModule;
+	ModuleReciprocal = STD_ULONG_MAX / thisModule;
+	RangeMaximum = 0;
 	}
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -78,6 +167,71 @@ INLINE	void	LinearGenerator::SetSeed(std_uint Seed) noexcept
 	Value = Seed;
 	}
 
+////////////////////////////////////////////////////////////////////////////////
+//! \par	Description:
+//!	Get the current seed of the linear congruent generator.
+//!
+//! \throw	None.
+//!
+//! \returns	std_uint	The latest generated value, that is the seed for
+//!				the next generation.
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+INLINE	std_uint	LinearGenerator::GetSeed(void) const noexcept
+	{
+	return Value;
+	}
+
+////////////////////////////////////////////////////////////////////////////////
+//! \par	Description:
+//!	Advance the linear congruent generator by a given number of steps, as
+//!	if the new value were computed Steps times, without generating the
+//!	intermediate values.
+//!
+//! \param	Steps	The number of steps.
+//!
+//! \throw	None.
+//!
+//! \returns	None.
+//!
+//! \note
+//!	Applying n times the step x -> (x * Multiplier + Constant) % Module
+//!	gives again an affine function x -> (x * A + C) % Module; A and C are
+//!	computed by repeated squaring of the single step, so that the time
+//!	required is proportional to the logarithm of Steps. \n
+//!	Module is less than 2 ^ 32, so all products fit in a std_ulong.
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+INLINE	void	LinearGenerator::Skip(std_ulong Steps) noexcept
+	{
+	register	std_ulong	StepMultiplier;
+	register	std_ulong	StepConstant;
+	register	std_ulong	TotalMultiplier;
+	register	std_ulong	TotalConstant;
+
+	StepMultiplier = Multiplier % Module;
+	StepConstant = Constant % Module;
+	TotalMultiplier = 1;
+	TotalConstant = 0;
+	for (; Steps != 0; Steps >>= 1)
+		{
+		if (Steps & 1)
+			{
+			TotalMultiplier = TotalMultiplier * StepMultiplier %
+				Module;
+			TotalConstant = (TotalConstant * StepMultiplier +
+				StepConstant) % Module;
+			}
+		StepConstant = (StepConstant * StepMultiplier + StepConstant) %
+			Module;
+		StepMultiplier = StepMultiplier * StepMultiplier % Module;
+		}
+	Value = static_cast<std_uint>((TotalMultiplier *
+		static_cast<std_ulong>(Value) + TotalConstant) % Module);
+	}
+
 ////////////////////////////////////////////////////////////////////////////////
 //! \par	Description:
 //!	Generate a new random number, between 0 and a given number, with uniform
@@ -91,11 +245,7 @@ INLINE	void	LinearGenerator::SetSeed(std_uint Seed) noexcept
 //!
 //! \returns	std_uint			The generated number.
 //!
-//! \note
-//!	A new value is computed as (Value * Multiplier + Constant) % Module and
-//!	it is stored in Value. To ensure equal probability for all numbers, the
-//!	process is repeated until Value <= Module - Module % Maximum, then
-//!	Value % Maximum + 1 is returned.
+//! \see	GenerateUnchecked
 //!
 ////////////////////////////////////////////////////////////////////////////////
 
@@ -104,15 +254,47 @@ INLINE	std_uint	LinearGenerator::Generate(std_uint Maximum)
 	{
 	if (Maximum >= Module)
 		throw make_fatal_exception(ILLEGAL_ARGUMENT);
+	return GenerateUnchecked(Maximum);
+	}
+
+////////////////////////////////////////////////////////////////////////////////
+//! \par	Description:
+//!	Generate a new random number, between 0 and a given number, with uniform
+//!	probability, without checking the given number.
+//!
+//! \param	Maximum		The maximum number that can be generated; it
+//!				must be less than Module.
+//!
+//! \throw	None.
+//!
+//! \returns	std_uint	The generated number.
+//!
+//! \note
+//!	A new value is computed as (Value * Multiplier + Constant) % Module and
+//!	it is stored in Value. To ensure equal probability for all numbers, the
+//!	process is repeated until Value <= Module - Module % Maximum, then
+//!	Value % Maximum + 1 is returned. \n
+//!	The remainders are computed without divisions, using ModuleReciprocal
+//!	and RangeReciprocal; the latter is computed again only when Maximum
+//!	changes.
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+INLINE	std_uint	LinearGenerator::GenerateUnchecked(std_uint Maximum)
+				noexcept
+	{
+	assert(Maximum < Module);
 	if (Maximum == 0)
 		return 0;
+	if (Maximum != RangeMaximum)
+		SetRange(Maximum);
 	for (;;)
 		{
-		Value = static_cast<std_uint>((static_cast<std_ulong>(
-			Multiplier) * static_cast<std_ulong>(Value) +
-			Constant) % Module);
-		if (Value <= Module - Module % Maximum)
-			return Value % (Maximum + 1);
+		Value = Reduce(static_cast<std_ulong>(Multiplier) *
+			static_cast<std_ulong>(Value) + Constant);
+		if (Value <= RangeLimit)
+			return static_cast<std_uint>(MultiplyHigh(RangeReciprocal *
+				Value, static_cast<std_ulong>(Maximum) + 1));
 		}
 	}
 
@@ -38,7 +38,9 @@ void		ReadParameters(const CharString& DirectoryPath,
 			std_uint& Candidates, std_uint& Voters,
 			std_uint& MaximumVote,
 			const byte VotersKey [ENCRYPTION_KEY_LENGTH],
-			const byte VotesKey [ENCRYPTION_KEY_LENGTH])
+			const byte VotesKey [ENCRYPTION_KEY_LENGTH],
+			std_uint& Engine, std_uint& DecoyVotes,
+			std_uint& SweepVotes, std_uint& Shards)
 			throw(FatalException, IOException,
 			ApplicationException);
 
@@ -50,7 +52,8 @@ void		ReadKeys(const CharString& KeyPath,
 
 void		EncodeKey(register const byte Key [ENCRYPTION_KEY_LENGTH],
 			char Buffer [4 * ENCRYPTION_KEY_LENGTH],
-			register RandomGenerator& Generator) noexcept;
+			register RandomGenerator& Generator, std_uint Engine)
+			throw(FatalException);
 
 void		InitializeGenerator(register RandomGenerator& Generator,
 			register const byte VotersKey [ENCRYPTION_KEY_LENGTH],
@@ -71,6 +74,15 @@ CharString	MakeVotersPathName(const CharString& DirectoryPath)
 CharString	MakeVotesPathName(const CharString& DirectoryPath)
 			throw(FatalException);
 
+CharString	MakeLocksPathName(const CharString& DirectoryPath)
+			throw(FatalException);
+
+CharString	MakeGenerationsPathName(const CharString& DirectoryPath)
+			throw(FatalException);
+
+CharString	MakeJournalPathName(const CharString& DirectoryPath)
+			throw(FatalException);
+
 }
 
 # if	defined USE_INLINE
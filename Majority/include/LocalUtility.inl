@@ -130,6 +130,67 @@ CharString	MakeVotesPathName(const CharString& DirectoryPath)
 	return MakePathName(DirectoryPath, CharString(VOTES_FILE_NAME));
 	}
 
+////////////////////////////////////////////////////////////////////////////////
+//! \par	Description:
+//!	Create the path name of the file containing the locks of the records of
+//!	the votes file.
+//!
+//! \param	DirectoryPath			Reference to the directory path
+//!						name.
+//!
+//! \throw	utility_space::OUT_OF_MEMORY	If memory allocation fails.
+//!
+//! \returns	CharString			The path name of the file
+//!						containing the locks.
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+CharString	MakeLocksPathName(const CharString& DirectoryPath)
+			throw(FatalException)
+	{
+	return MakePathName(DirectoryPath, CharString(LOCKS_FILE_NAME));
+	}
+
+////////////////////////////////////////////////////////////////////////////////
+//! \par	Description:
+//!	Create the path name of the file containing the generations of the votes
+//!	of the voters.
+//!
+//! \param	DirectoryPath			Reference to the directory path
+//!						name.
+//!
+//! \throw	utility_space::OUT_OF_MEMORY	If memory allocation fails.
+//!
+//! \returns	CharString			The path name of the file
+//!						containing the generations.
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+CharString	MakeGenerationsPathName(const CharString& DirectoryPath)
+			throw(FatalException)
+	{
+	return MakePathName(DirectoryPath, CharString(GENERATIONS_FILE_NAME));
+	}
+
+////////////////////////////////////////////////////////////////////////////////
+//! \par	Description:
+//!	Create the path name of the journal of the votes.
+//!
+//! \param	DirectoryPath			Reference to the directory path
+//!						name.
+//!
+//! \throw	utility_space::OUT_OF_MEMORY	If memory allocation fails.
+//!
+//! \returns	CharString			The path name of the journal.
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+CharString	MakeJournalPathName(const CharString& DirectoryPath)
+			throw(FatalException)
+	{
+	return MakePathName(DirectoryPath, CharString(JOURNAL_FILE_NAME));
+	}
+
 }
 
 
@@ -36,10 +36,15 @@
 # define	CREATE_USAGE_FORMAT \
 	"Usage:\n" \
 	"\tCreateMajority <election directory> <candidates> <voters> " \
-	"<maximum vote> <keys file>\n\n" \
+	"<maximum vote> <keys file> [<decoy votes> [<noise votes> " \
+	"[<shards>]]]\n\n" \
 	"\t<candidates> must be in the range [%u .. %u]\n" \
 	"\t<voters> must be in the range [%u .. %u]\n" \
-	"\t<maximum vote> must be in the range [%u .. %u]\n"
+	"\t<maximum vote> must be in the range [%u .. %u]\n" \
+	"\t<decoy votes> must be in the range [%u .. %u], default %u\n" \
+	"\t<noise votes> must be in the range [1 .. %u], default %u\n" \
+	"\t<shards> must be in the range [1 .. %u] and not greater than " \
+	"<voters>, default %u\n"
 
 //! \def	CREATE_FORMAT
 //!	Message printed when the program terminates successfully.
@@ -64,7 +69,9 @@
 //!	Format of the message printed to explain the usage of the election
 //!	voting program.
 # define	VOTE_USAGE_FORMAT \
-	"Usage:\n\tVoteMajority <election directory> <keys file>\n"
+	"Usage:\n\tVoteMajority <election directory> <keys file> " \
+	"[<votes per synchronization>]\n\n" \
+	"\t<votes per synchronization> must be in the range [1 .. %u]\n"
 
 //! \def	VOTE_SET_FORMAT
 //!	Format of the message printed when a voter's vote has has been set.
@@ -95,7 +102,8 @@
 //!	program.
 # define	NOISE_USAGE_FORMAT \
 	"Usage:\n\tNoiseMajority <election directory> <keys file> " \
-	"<iterations> [<interval>]\n\n"
+	"<iterations> [<interval>]\n\n" \
+	"\t<iterations> equal to 0 means forever\n"
 
 ////////////////////////////////////////////////////////////////////////////////
 //!	\}
@@ -115,7 +123,21 @@
 //!	closing program.
 # define	RESULT_USAGE_FORMAT \
 	"Usage:\n" \
-	"\tResultMajority <election directory> <keys file> [<interval>]\n\n"
+	"\tResultMajority [%s <threads>] [%s] <election directory> " \
+	"<keys file> [<interval>]\n\n" \
+	"\t<threads> must be in the range [1 .. %u], default %u\n" \
+	"\t<interval> must be in the range [1 .. %u] minutes\n" \
+	"\t%s recomputes the result when the votes change, at least once " \
+	"per <interval>\n"
+
+//! \def	THREADS_OPTION
+//!	Command line option to set the number of threads reading the votes.
+# define	THREADS_OPTION		"--threads"
+
+//! \def	WATCH_OPTION
+//!	Command line option to recompute the result when the votes change,
+//!	and at least once per interval, instead of at regular intervals.
+# define	WATCH_OPTION		"--watch"
 
 //! \def	ELECTION_HEADER_FORMAT
 //!	Message printed as header of the election results.
@@ -151,4 +173,85 @@
 //!	\}
 ////////////////////////////////////////////////////////////////////////////////
 
+////////////////////////////////////////////////////////////////////////////////
+//!
+//! \defgroup	BenchmarkMessage	Cryptography benchmark program messages
+//!	Definitions of messages used by the cryptography benchmark program.
+//!
+//!	\{
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+//! \def	BENCHMARK_USAGE_FORMAT
+//!	Format of the message printed to explain the usage of the cryptography
+//!	benchmark program.
+# define	BENCHMARK_USAGE_FORMAT \
+	"Usage:\n\tBenchmarkMajority [<blocks>]\n\n" \
+	"\t<blocks> must be in the range [%u .. %u]\n"
+
+//! \def	KNOWN_ANSWER_FORMAT
+//!	Format of the message printed after checking the known answer vectors.
+# define	KNOWN_ANSWER_FORMAT \
+	"Known answer vectors: %u checked, %u failed, %u skipped\n\n"
+
+//! \def	KNOWN_ANSWER_FAILURE_FORMAT
+//!	Format of the message printed when a known answer vector is not matched.
+# define	KNOWN_ANSWER_FAILURE_FORMAT \
+	"Known answer vector %u failed (%s)\n"
+
+//! \def	BLOCK_SEQUENCE_FORMAT
+//!	Format of the message printed after checking the sequences of blocks.
+# define	BLOCK_SEQUENCE_FORMAT \
+	"Block sequences: %u engines checked, %u failed\n\n"
+
+//! \def	BLOCK_SEQUENCE_FAILURE_FORMAT
+//!	Format of the message printed when a sequence of blocks is not processed
+//!	like its single blocks.
+# define	BLOCK_SEQUENCE_FAILURE_FORMAT \
+	"Block sequence of engine %s failed (%s)\n"
+
+//! \def	SUB_STREAM_FORMAT
+//!	Format of the message printed after checking the sub-streams of the
+//!	random number generator.
+# define	SUB_STREAM_FORMAT \
+	"Sub-streams: %u checks, %u failed\n\n"
+
+//! \def	SUB_STREAM_FAILURE_FORMAT
+//!	Format of the message printed when a check of the sub-streams fails.
+# define	SUB_STREAM_FAILURE_FORMAT \
+	"Sub-stream check failed (%s)\n"
+
+//! \def	TABLE_SETUP_FORMAT
+//!	Format of the message printed with the cost of the computation of the
+//!	tables shared by all Cryptography objects.
+# define	TABLE_SETUP_FORMAT \
+	"Table setup: %lu cycles, %lu ns\n\n"
+
+//! \def	BENCHMARK_HEADER
+//!	Message printed as header of the benchmark results.
+# define	BENCHMARK_HEADER \
+	"Engine   Operation          Blocks/s    Cycles/byte\n"
+
+//! \def	BENCHMARK_RESULT_FORMAT
+//!	Format used to print the result of an encryption or decryption
+//!	benchmark.
+# define	BENCHMARK_RESULT_FORMAT	"%-8s %-13s %13.0f %14.2f\n"
+
+//! \def	SET_KEY_RESULT_FORMAT
+//!	Format used to print the result of the key setting benchmark.
+# define	SET_KEY_RESULT_FORMAT \
+	"%-8s %-13s %13.0f keys/s %7.0f cycles/key\n"
+
+//! \def	FEISTEL_ENGINE_NAME
+//!	Name of the S-box Feistel cipher engine.
+# define	FEISTEL_ENGINE_NAME	"Feistel"
+
+//! \def	AES_ENGINE_NAME
+//!	Name of the AES cipher engine.
+# define	AES_ENGINE_NAME		"AES"
+
+////////////////////////////////////////////////////////////////////////////////
+//!	\}
+////////////////////////////////////////////////////////////////////////////////
+
 # endif
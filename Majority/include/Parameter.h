@@ -27,6 +27,35 @@
 //!	Length of signature in bytes.
 # define	SIGNATURE_LENGTH		32
 
+//! \def	FEISTEL_ENGINE
+//!	Identifier of the cipher engine using a Feistel network whose steps use
+//!	S-box and bit diffusion tables.
+//!
+//! \note
+//!	It is used by elections whose parameters file does not record a cipher
+//!	engine, if they were created after encryption was enabled.
+# define	FEISTEL_ENGINE			0
+
+//! \def	AES_ENGINE
+//!	Identifier of the cipher engine using a Feistel network whose steps use
+//!	AES rounds, executed by AES-NI instructions.
+# define	AES_ENGINE			1
+
+//! \def	MAXIMUM_ENGINE
+//!	Maximum identifier of a cipher engine that can be recorded in the
+//!	parameters file.
+# define	MAXIMUM_ENGINE			AES_ENGINE
+
+//! \def	PLAIN_ENGINE
+//!	Identifier of the pass-through engine, that copies the data without
+//!	encrypting them.
+//!
+//! \note
+//!	It is never recorded in the parameters file: it is used by elections
+//!	created before encryption was enabled, whose parameters file does not
+//!	record a cipher engine and contains the keys in clear.
+# define	PLAIN_ENGINE			(MAXIMUM_ENGINE + 1)
+
 //! \def	ELECTION_FILE_NAME
 //!	Name of the file containing the parameters of the election:
 # define	ELECTION_FILE_NAME		"Election"
@@ -40,6 +69,19 @@
 //!	Name of the file containing the votes.
 # define	VOTES_FILE_NAME			"Votes"
 
+//! \def	LOCKS_FILE_NAME
+//!	Name of the file containing the locks of the records of the votes file.
+# define	LOCKS_FILE_NAME			"Locks"
+
+//! \def	GENERATIONS_FILE_NAME
+//!	Name of the file containing the generations of the votes of the voters.
+# define	GENERATIONS_FILE_NAME		"Generations"
+
+//! \def	JOURNAL_FILE_NAME
+//!	Name of the file containing the votes acknowledged and not yet written
+//!	into the votes file.
+# define	JOURNAL_FILE_NAME		"Journal"
+
 //! \def	MINIMUM_CANDIDATES
 //!	Minimum number of candidates.
 # define	MINIMUM_CANDIDATES		2
@@ -65,13 +107,39 @@
 # define	MAXIMUM_VOTE			15
 
 //! \def	RANDOM_VOTES
-//!	Minimum number of modified record when a vote is inserted.
+//!	Default and maximum value of the minimum number of modified record when
+//!	a vote is inserted.
 //!
 //! \note
 //!	The number of votes actually modified is randomly chosen in the interval
-//!	[RANDOM_VOTES .. RANDOM_VOTES * 3 / 2].
+//!	[decoy votes .. decoy votes * 3 / 2], where the number of decoy votes is
+//!	set in the election parameters file.
 # define	RANDOM_VOTES			100
 
+//! \def	MINIMUM_DECOY_VOTES
+//!	Minimum value of the minimum number of modified record when a vote is
+//!	inserted.
+# define	MINIMUM_DECOY_VOTES		10
+
+//! \def	DEFAULT_SWEEP_VOTES
+//!	Default number of votes modified at each iteration of the noise
+//!	generation.
+# define	DEFAULT_SWEEP_VOTES		1
+
+//! \def	MAXIMUM_SWEEP_VOTES
+//!	Maximum number of votes modified at each iteration of the noise
+//!	generation.
+# define	MAXIMUM_SWEEP_VOTES		1000
+
+//! \def	DEFAULT_SHARDS
+//!	Default number of files the votes are split into.
+# define	DEFAULT_SHARDS			1
+
+//! \def	MAXIMUM_SHARDS
+//!	Maximum number of files the votes are split into; each file contains
+//!	the records of a range of adjacent voters.
+# define	MAXIMUM_SHARDS			16
+
 //! \def	MAXIMUM_NOISE_INTERVAL
 //!	Maximum time interval for noise generation in seconds.
 # define	MAXIMUM_NOISE_INTERVAL		3600
@@ -80,4 +148,43 @@
 //!	Maximum time interval for resut generation in minutes.
 # define	MAXIMUM_RESULT_INTERVAL	1440
 
+//! \def	RESULT_QUIET_TIME
+//!	Time without changes to the journal, in milliseconds, after which the
+//!	result is recomputed, when watching the journal.
+# define	RESULT_QUIET_TIME		1000
+
+//! \def	RESULT_MAXIMUM_DELAY
+//!	Maximum time, in milliseconds, between the first change to the journal
+//!	and the computation of the result, when watching the journal and the
+//!	changes do not stop.
+# define	RESULT_MAXIMUM_DELAY		10000
+
+//! \def	DEFAULT_RESULT_THREADS
+//!	Default number of threads reading the votes when computing the result.
+# define	DEFAULT_RESULT_THREADS		1
+
+//! \def	MAXIMUM_RESULT_THREADS
+//!	Maximum number of threads reading the votes when computing the result.
+# define	MAXIMUM_RESULT_THREADS		64
+
+//! \def	DEFAULT_SYNCHRONIZATION_VOTES
+//!	Default number of votes written between two synchronizations of the
+//!	votes file with the disk.
+# define	DEFAULT_SYNCHRONIZATION_VOTES	1
+
+//! \def	MAXIMUM_SYNCHRONIZATION_VOTES
+//!	Maximum number of votes written between two synchronizations of the
+//!	votes file with the disk.
+# define	MAXIMUM_SYNCHRONIZATION_VOTES	1000
+
+//! \def	SYNCHRONIZATION_DELAY
+//!	Maximum time, in milliseconds, a vote waits for the following votes of
+//!	its group before the group is written and acknowledged.
+# define	SYNCHRONIZATION_DELAY		10
+
+//! \def	JOURNAL_APPLY_VOTES
+//!	Number of votes collected in the journal before writing them into the
+//!	votes file.
+# define	JOURNAL_APPLY_VOTES		1000
+
 # endif
@@ -24,6 +24,9 @@
 //!	Maximum random number that can be generated.
 # define	MAXIMUM_RANDOM_NUMBER		3000000000
 
+static_assert(LINEAR_GENERATORS - 1 < DEFAULT_MODULE,
+	"Wrong LINEAR_GENERATORS, the selector cannot generate all the indexes");
+
 namespace	utility_space
 {
 
@@ -106,9 +109,24 @@ class	RandomGenerator
 						const std_uint Seed
 						[LINEAR_GENERATORS]) noexcept;
 
+		void			Skip(std_ulong Steps) noexcept;
+
+		void			Split(std_uint Stream,
+						RandomGenerator& SubStream)
+						const noexcept;
+
 		std_uint		Generate(std_uint Maximum)
 						throw(FatalException);
 
+		void			Fill(byte* Destination, std_uint Length,
+						std_uint Maximum)
+						throw(FatalException);
+
+		void			Fill(byte* Destination, std_uint Length,
+						std_uint Maximum,
+						std_uint Stride)
+						throw(FatalException);
+
 	};
 
 }
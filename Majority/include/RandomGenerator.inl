@@ -44,4 +44,73 @@ INLINE	std_uint	RandomGenerator::Generate(std_uint Maximum)
 		Generate(Maximum);
 	}
 
+////////////////////////////////////////////////////////////////////////////////
+//! \par	Description:
+//!	Fill a buffer with random numbers, between 0 and a given number, with
+//!	uniform probability.
+//!
+//! \param	Destination			The buffer.
+//! \param	Length				The number of bytes to fill.
+//! \param	Maximum				The maximum number that can be
+//!						generated.
+//!
+//! \throw	utility_space::ILLEGAL_ARGUMENT	If Maximum is greater than
+//!						BYTE_MAX.
+//!
+//! \returns	None.
+//!
+//! \note
+//!	The numbers are the same that would be returned by Length calls of
+//!	Generate.
+//!
+//! \see	BYTE_MAX
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+INLINE	void	RandomGenerator::Fill(byte* Destination, std_uint Length,
+			std_uint Maximum) throw(FatalException)
+	{
+	Fill(Destination, Length, Maximum, 1);
+	}
+
+////////////////////////////////////////////////////////////////////////////////
+//! \par	Description:
+//!	Store random numbers, between 0 and a given number, with uniform
+//!	probability, in equally spaced bytes of a buffer.
+//!
+//! \param	Destination			The first byte to store.
+//! \param	Length				The number of bytes to store.
+//! \param	Maximum				The maximum number that can be
+//!						generated.
+//! \param	Stride				The distance between two bytes
+//!						to store.
+//!
+//! \throw	utility_space::ILLEGAL_ARGUMENT	If Maximum is greater than
+//!						BYTE_MAX.
+//!
+//! \returns	None.
+//!
+//! \note
+//!	The numbers are the same that would be returned by Length calls of
+//!	Generate; Maximum is checked only once, since all the modules are
+//!	greater than BYTE_MAX, as the constructor asserts.
+//!
+//! \see	BYTE_MAX
+//! \see	LINEAR_GENERATORS
+//! \see	RandomGenerator()
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+INLINE	void	RandomGenerator::Fill(register byte* Destination,
+			register std_uint Length, std_uint Maximum,
+			std_uint Stride) throw(FatalException)
+	{
+	if (Maximum > BYTE_MAX)
+		throw make_fatal_exception(ILLEGAL_ARGUMENT);
+	for (; Length > 0; --Length, Destination += Stride)
+		*Destination = static_cast<byte>(GeneratorArray [
+			RandomSelector.GenerateUnchecked(LINEAR_GENERATORS -
+			1)].GenerateUnchecked(Maximum));
+	}
+
 }
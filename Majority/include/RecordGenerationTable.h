@@ -0,0 +1,119 @@
+////////////////////////////////////////////////////////////////////////////////
+//! \file
+//!
+//! \author	agent
+//!
+//! \date	17/10/2026
+//!
+//! \par	Function:
+//!	It contains the declaration of the io_space::RecordGenerationTable
+//!	class.
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+# if !defined	RECORD_GENERATION_TABLE_H
+
+# define	RECORD_GENERATION_TABLE_H
+
+# include	"Parameter.h"
+# include	"FatalException.h"
+# include	"IOException.h"
+# include	"ApplicationException.h"
+# include	"File.h"
+
+namespace	io_space
+{
+
+using	namespace	utility_space;
+using	namespace	application_space;
+
+////////////////////////////////////////////////////////////////////////////////
+//! \class	RecordGenerationTable
+//!	The RecordGenerationTable class represents a File containing, for each
+//!	voter, the number of times the vote of the voter has been written into
+//!	the votes file, modulo the range of a std_uint.
+//!
+//! \note
+//!	The file is mapped in memory by every process, so that a generation is
+//!	read or advanced without system calls; a generation is advanced only
+//!	while the record of the voter is locked, after the record has been
+//!	written, so that a process that reads the generation before the record
+//!	finds a different generation at the next reading, if the record is being
+//!	rewritten.
+//!
+//! \note
+//!	Rewriting a record with new fillers does not change the votes, hence it
+//!	does not advance the generation.
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+class	RecordGenerationTable: private File
+	{
+	private:
+
+//! \property	MappedGenerations
+//!	Address of the table mapped in memory, or nullptr if the table is not
+//!	open.
+			std_uint*		MappedGenerations;
+
+//! \property	Voters
+//!	Number of voters.
+			std_uint		Voters;
+
+					RecordGenerationTable(const
+						RecordGenerationTable&
+						Argument) noexcept = delete;
+
+					RecordGenerationTable(
+						RecordGenerationTable&&
+						Argument) noexcept = delete;
+
+			RecordGenerationTable&	operator = (const
+							RecordGenerationTable&
+							Argument) noexcept =
+							delete;
+
+			RecordGenerationTable&	operator = (
+							RecordGenerationTable&&
+							Argument) noexcept =
+							delete;
+
+	public:
+
+					RecordGenerationTable(void)
+						throw(FatalException);
+
+					~RecordGenerationTable(void)
+						throw(FatalException,
+						IOException);
+
+			bool		IsOpened(void) const noexcept;
+
+			void		Create(const CharString& thisPathName,
+						std_uint thisVoters)
+						throw(FatalException,
+						IOException);
+
+			void		Open(const CharString& thisPathName,
+						std_uint thisVoters)
+						throw(FatalException,
+						IOException,
+						ApplicationException);
+
+			std_uint	GetGeneration(std_uint Voter) const
+						noexcept;
+
+			void		Advance(std_uint Voter) noexcept;
+
+			void		Close(void) throw(FatalException,
+						IOException);
+
+	};
+
+}
+
+# if defined	USE_INLINE
+# include	"RecordGenerationTable.inl"
+# endif
+
+# endif
@@ -0,0 +1,125 @@
+////////////////////////////////////////////////////////////////////////////////
+//! \file
+//!
+//! \author	agent
+//!
+//! \date	17/10/2026
+//!
+//! \par	Function:
+//!	It contains the definitions of inline functions of the
+//!	io_space::RecordGenerationTable class.
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+namespace	io_space
+{
+
+using	namespace	utility_space;
+
+////////////////////////////////////////////////////////////////////////////////
+//! \par	Description:
+//!	Default constructor
+//!
+//! \throw	utility_space::OUT_OF_MEMORY	If memory allocation fails.
+//!
+//! \returns	Not applicable.
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+INLINE	RecordGenerationTable::RecordGenerationTable(void)
+		throw(FatalException): File(), MappedGenerations(nullptr),
+		Voters(0)
+	{
+	}
+
+////////////////////////////////////////////////////////////////////////////////
+//! \par	Description:
+//!	Destructor; if the file is still open, the function removes its
+//!	mapping, closes it and throws an exception.
+//!
+//! \throw	utility_space::OUT_OF_MEMORY	If memory allocation fails when
+//!						creating an exception.
+//! \throw	io_space::FILE_CLOSE_ERROR	If the File is open and an error
+//!						occurs while closing it.
+//! \throw	io_space::FILE_NOT_CLOSED	If the File is open.
+//!
+//! \returns	Not applicable.
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+INLINE	RecordGenerationTable::~RecordGenerationTable(void)
+		throw(FatalException, IOException)
+	{
+	if (MappedGenerations != nullptr)
+		Unmap(MappedGenerations, static_cast<std_ulong>(Voters) *
+			sizeof(std_uint));
+	}
+
+////////////////////////////////////////////////////////////////////////////////
+//! \par	Description:
+//!	Check if the table is open.
+//!
+//! \throw	None.
+//!
+//! \returns	bool	True if the table is open, false otherwise.
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+INLINE	bool	RecordGenerationTable::IsOpened(void) const noexcept
+	{
+	return MappedGenerations != nullptr;
+	}
+
+////////////////////////////////////////////////////////////////////////////////
+//! \par	Description:
+//!	Get the generation of the vote of a voter.
+//!
+//! \param	Voter		Index of the voter.
+//!
+//! \throw	None.
+//!
+//! \returns	std_uint	The generation of the vote.
+//!
+//! \note
+//!	The generation is read from the mapped file every time, since it can be
+//!	advanced by other processes; the read has acquire semantics, so that
+//!	the record written before the generation was advanced is seen.
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+INLINE	std_uint	RecordGenerationTable::GetGeneration(std_uint Voter)
+				const noexcept
+	{
+	assert(MappedGenerations != nullptr and Voter < Voters);
+	return __atomic_load_n(MappedGenerations + Voter, __ATOMIC_ACQUIRE);
+	}
+
+////////////////////////////////////////////////////////////////////////////////
+//! \par	Description:
+//!	Advance the generation of the vote of a voter.
+//!
+//! \param	Voter		Index of the voter.
+//!
+//! \throw	None.
+//!
+//! \returns	None.
+//!
+//! \note
+//!	The record of the voter must be locked, so that no other process
+//!	advances the same generation at the same time; the write has release
+//!	semantics, so that the record written before is seen by a process
+//!	that reads the new generation.
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+INLINE	void	RecordGenerationTable::Advance(std_uint Voter) noexcept
+	{
+	register	std_uint*	Generation;
+
+	assert(MappedGenerations != nullptr and Voter < Voters);
+	Generation = MappedGenerations + Voter;
+	__atomic_store_n(Generation, __atomic_load_n(Generation,
+		__ATOMIC_RELAXED) + 1, __ATOMIC_RELEASE);
+	}
+
+}
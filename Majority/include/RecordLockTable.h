@@ -0,0 +1,154 @@
+////////////////////////////////////////////////////////////////////////////////
+//! \file
+//!
+//! \author	agent
+//!
+//! \date	16/10/2026
+//!
+//! \par	Function:
+//!	It contains the declaration of the io_space::RecordLockTable class.
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+# if !defined	RECORD_LOCK_TABLE_H
+
+# define	RECORD_LOCK_TABLE_H
+
+# include	"Parameter.h"
+# include	"FatalException.h"
+# include	"IOException.h"
+# include	"ApplicationException.h"
+# include	"SystemManager.h"
+# include	"File.h"
+
+//! \def	LOCK_STRIPES
+//!	Number of locks in the table; the record with index i is protected by
+//!	the lock with index i % LOCK_STRIPES.
+# define	LOCK_STRIPES			4096
+
+//! \def	LOCK_TABLE_MAGIC
+//!	Value stored in the header of an initialized lock table.
+# define	LOCK_TABLE_MAGIC		0x4B434F4C45544F56ULL
+
+//! \def	LOCK_TABLE_LENGTH
+//!	Length of the file containing the lock table: a header followed by the
+//!	locks, each one in its own cache line.
+# define	LOCK_TABLE_LENGTH		((LOCK_STRIPES + 1) *		\
+						SHARED_LOCK_SIZE)
+
+namespace	io_space
+{
+
+using	namespace	utility_space;
+using	namespace	application_space;
+
+////////////////////////////////////////////////////////////////////////////////
+//! \struct	LockTableHeader
+//!	The LockTableHeader struct contains the data stored at the beginning of
+//!	the lock table.
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+struct	LockTableHeader
+	{
+//! \property	Magic
+//!	LOCK_TABLE_MAGIC if the locks have been initialized, 0 otherwise.
+	std_ulong		Magic;
+
+//! \property	BootIdentifier
+//!	Identifier of the boot of the system when the locks were initialized.
+	std_ulong		BootIdentifier;
+	};
+
+static_assert(sizeof(LockTableHeader) <= SHARED_LOCK_SIZE,
+	"Wrong SHARED_LOCK_SIZE, less than the lock table header");
+
+static_assert(LOCK_STRIPES % (sizeof(std_ulong) * BYTE_BITS) == 0,
+	"Wrong LOCK_STRIPES, not a multiple of the bits of a std_ulong");
+
+////////////////////////////////////////////////////////////////////////////////
+//! \class	RecordLockTable
+//!	The RecordLockTable class represents a File containing a table of locks
+//!	shared by all the processes modifying the votes of an election.
+//!
+//! \note
+//!	The file is mapped in memory by every process, so that a free lock is
+//!	acquired and released without system calls. \n
+//!	The locks are robust: if a process terminates while holding some lock,
+//!	the next process waiting for it acquires it.
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+class	RecordLockTable: private File
+	{
+	private:
+
+//! \property	MappedTable
+//!	Address of the table mapped in memory, or nullptr if the table is not
+//!	open.
+			byte*			MappedTable;
+
+//! \property	LockedStripes
+//!	Bit map of the locks held by the process.
+			std_ulong		LockedStripes [LOCK_STRIPES /
+							(sizeof(std_ulong) *
+							BYTE_BITS)];
+
+					RecordLockTable(const RecordLockTable&
+						Argument) noexcept = delete;
+
+					RecordLockTable(RecordLockTable&&
+						Argument) noexcept = delete;
+
+			RecordLockTable&	operator = (const
+							RecordLockTable&
+							Argument) noexcept =
+							delete;
+
+			RecordLockTable&	operator = (RecordLockTable&&
+							Argument) noexcept =
+							delete;
+
+			void*		GetLock(std_uint Stripe) const noexcept;
+
+			void		Initialize(void) throw(FatalException,
+						IOException);
+
+	public:
+
+					RecordLockTable(void)
+						throw(FatalException);
+
+					~RecordLockTable(void)
+						throw(FatalException,
+						IOException);
+
+			bool		IsOpened(void) const noexcept;
+
+			void		Create(const CharString& thisPathName)
+						throw(FatalException,
+						IOException);
+
+			void		Open(const CharString& thisPathName)
+						throw(FatalException,
+						IOException,
+						ApplicationException);
+
+			void		Lock(register const std_uint* Records,
+						register std_uint Count)
+						noexcept;
+
+			void		Unlock(void) noexcept;
+
+			void		Close(void) throw(FatalException,
+						IOException);
+
+	};
+
+}
+
+# if defined	USE_INLINE
+# include	"RecordLockTable.inl"
+# endif
+
+# endif
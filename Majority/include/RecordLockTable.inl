@@ -0,0 +1,98 @@
+////////////////////////////////////////////////////////////////////////////////
+//! \file
+//!
+//! \author	agent
+//!
+//! \date	16/10/2026
+//!
+//! \par	Function:
+//!	It contains the definitions of inline functions of the
+//!	io_space::RecordLockTable class.
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+namespace	io_space
+{
+
+using	namespace	utility_space;
+
+////////////////////////////////////////////////////////////////////////////////
+//! \par	Description:
+//!	Get the address of a lock of the mapped table.
+//!
+//! \param	Stripe		The index of the lock.
+//!
+//! \throw	None.
+//!
+//! \returns	void*		The address of the lock.
+//!
+//! \see	SHARED_LOCK_SIZE
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+INLINE	void*	RecordLockTable::GetLock(std_uint Stripe) const noexcept
+	{
+	return MappedTable + (static_cast<std_ulong>(Stripe) + 1) *
+		SHARED_LOCK_SIZE;
+	}
+
+////////////////////////////////////////////////////////////////////////////////
+//! \par	Description:
+//!	Default constructor
+//!
+//! \throw	utility_space::OUT_OF_MEMORY	If memory allocation fails.
+//!
+//! \returns	Not applicable.
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+INLINE	RecordLockTable::RecordLockTable(void) throw(FatalException): File(),
+		MappedTable(nullptr), LockedStripes()
+	{
+	}
+
+////////////////////////////////////////////////////////////////////////////////
+//! \par	Description:
+//!	Destructor; if the file is still open, the function releases the locks
+//!	held, removes its mapping, closes it and throws an exception.
+//!
+//! \throw	utility_space::OUT_OF_MEMORY	If memory allocation fails when
+//!						creating an exception.
+//! \throw	io_space::FILE_CLOSE_ERROR	If the File is open and an error
+//!						occurs while closing it.
+//! \throw	io_space::FILE_NOT_CLOSED	If the File is open.
+//!
+//! \returns	Not applicable.
+//!
+//! \note
+//!	The exception could be thrown when the File is destroyed while
+//!	processing another exception, thrown but not yet caught.
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+INLINE	RecordLockTable::~RecordLockTable(void) throw(FatalException,
+		IOException)
+	{
+	if (MappedTable != nullptr)
+		{
+		Unlock();
+		Unmap(MappedTable, LOCK_TABLE_LENGTH);
+		}
+	}
+
+////////////////////////////////////////////////////////////////////////////////
+//! \par	Description:
+//!	Tell whether the table is open.
+//!
+//! \throw	None.
+//!
+//! \returns	bool		true if the table is open.
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+INLINE	bool	RecordLockTable::IsOpened(void) const noexcept
+	{
+	return MappedTable != nullptr;
+	}
+
+}
@@ -0,0 +1,197 @@
+////////////////////////////////////////////////////////////////////////////////
+//! \file
+//!
+//! \author	agent
+//!
+//! \date	16/10/2026
+//!
+//! \par	Function:
+//!	It contains the declaration of the io_space::VoteJournal class.
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+# if !defined	VOTE_JOURNAL_H
+
+# define	VOTE_JOURNAL_H
+
+# include	"Parameter.h"
+# include	"FatalException.h"
+# include	"IOException.h"
+# include	"ApplicationException.h"
+# include	"File.h"
+# include	"Vector.h"
+# include	"RandomGenerator.h"
+# include	"Cryptography.h"
+# include	"VotesFile.h"
+
+//! \def	JOURNAL_HEADER_BLOCKS
+//!	Number of cryptography blocks at the beginning of an entry of the
+//!	journal, containing the checksum of the rest of the entry and the index
+//!	of the voter.
+# define	JOURNAL_HEADER_BLOCKS		1
+
+//! \def	JOURNAL_CHECKSUM_BASIS
+//!	Initial value of the checksum of an entry of the journal.
+# define	JOURNAL_CHECKSUM_BASIS		2166136261U
+
+//! \def	JOURNAL_CHECKSUM_PRIME
+//!	Multiplier used to compute the checksum of an entry of the journal.
+# define	JOURNAL_CHECKSUM_PRIME		16777619U
+
+namespace	io_space
+{
+
+using	namespace	utility_space;
+using	namespace	application_space;
+
+static_assert(2 * sizeof(std_uint) <=
+	JOURNAL_HEADER_BLOCKS * ENCRYPTION_BLOCK_LENGTH,
+	"Wrong JOURNAL_HEADER_BLOCKS, less than the header length");
+
+////////////////////////////////////////////////////////////////////////////////
+//! \class	VoteJournal
+//!	The VoteJournal class represents a File containing the votes
+//!	acknowledged and not yet written into the votes file.
+//!
+//! \note
+//!	Each entry contains a checksum, the index of the voter and the votes and
+//!	the signature encoded with random fillers as in the votes file, and it
+//!	is encrypted with the key of the votes file; an entry whose checksum is
+//!	wrong has been written only partially and it marks the end of the
+//!	journal. \n
+//!	The journal is shared by all the processes writing the votes of the
+//!	election: the entries are appended and applied only while the first
+//!	byte of the file is locked, so that the entries keep the order of their
+//!	acknowledgement.
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+class	VoteJournal: private File
+	{
+	private:
+
+//! \property	Candidates
+//!	Number of candidates.
+			std_uint		Candidates;
+
+//! \property	VotesBlocks
+//!	Number of cryptography blocks used for the votes.
+			std_uint		VotesBlocks;
+
+//! \property	SignatureBlocks
+//!	Number of cryptography blocks used for the signature.
+			std_uint		SignatureBlocks;
+
+//! \property	EntryLength
+//!	Length of an entry.
+			std_uint		EntryLength;
+
+//! \property	Entries
+//!	Number of entries written into the file.
+			std_uint		Entries;
+
+//! \property	Encoder
+//!	Encoder used to crypt and decrypt the file.
+			Cryptography		Encoder;
+
+//! \property	PendingEntries
+//!	Buffer containing the encrypted entries not yet written into the file.
+			Vector<byte>		PendingEntries;
+
+//! \property	EntryBuffer
+//!	Buffer containing the decrypted entry being read.
+			Vector<byte>		EntryBuffer;
+
+//! \property	AppliedVote
+//!	Vote read from the file while the entries are applied to the votes
+//!	file.
+			VoteData		AppliedVote;
+
+//! \property	AppliedVotes
+//!	Votes read from the file, to be written together into the votes file.
+			Vector<VoteData>	AppliedVotes;
+
+					VoteJournal(const VoteJournal&
+						Argument) noexcept = delete;
+
+					VoteJournal(VoteJournal&& Argument)
+						noexcept = delete;
+
+			VoteJournal&	operator = (const VoteJournal& Argument)
+						noexcept = delete;
+
+			VoteJournal&	operator = (VoteJournal&& Argument)
+						noexcept = delete;
+
+			bool		Read(std_uint Entry,
+						register VoteData& CurrentVote)
+						throw(FatalException,
+						IOException);
+
+		static	std_uint	ComputeChecksum(register const byte*
+						Buffer, register std_uint
+						Length) noexcept;
+
+	public:
+
+					VoteJournal(void)
+						throw(FatalException);
+
+					~VoteJournal(void)
+						throw(FatalException,
+						IOException);
+
+			using		File::IsOpened;
+
+			std_uint	GetEntries(void) const noexcept;
+
+			void		Create(const CharString& thisPathName)
+						throw(FatalException,
+						IOException);
+
+			bool		Open(const CharString& thisPathName,
+						std_uint thisCandidates,
+						const byte Key
+						[ENCRYPTION_KEY_LENGTH],
+						std_uint Engine)
+						throw(FatalException,
+						IOException);
+
+			void		Lock(void) throw(FatalException,
+						IOException);
+
+			void		Unlock(void) throw(FatalException,
+						IOException);
+
+			void		Append(register const VoteData&
+						CurrentVote,
+						RandomGenerator&
+						FillerGenerator)
+						throw(FatalException);
+
+			void		Commit(void) throw(FatalException,
+						IOException);
+
+			void		Apply(VotesFile& CurrentVotesFile,
+						const byte VotersKey
+						[ENCRYPTION_KEY_LENGTH],
+						const byte VotesKey
+						[ENCRYPTION_KEY_LENGTH],
+						RandomGenerator&
+						FillerGenerator)
+						throw(FatalException,
+						IOException,
+						ApplicationException);
+
+			void		Close(void) throw(FatalException,
+						IOException);
+
+	};
+
+}
+
+# if defined	USE_INLINE
+# include	"VoteJournal.inl"
+# endif
+
+# endif
@@ -0,0 +1,101 @@
+////////////////////////////////////////////////////////////////////////////////
+//! \file
+//!
+//! \author	agent
+//!
+//! \date	16/10/2026
+//!
+//! \par	Function:
+//!	It contains the definitions of inline functions of the
+//!	io_space::VoteJournal class.
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+namespace	io_space
+{
+
+using	namespace	utility_space;
+
+////////////////////////////////////////////////////////////////////////////////
+//! \par	Description:
+//!	Compute the checksum of a part of an entry.
+//!
+//! \param	Buffer		Pointer to the bytes.
+//! \param	Length		Number of bytes.
+//!
+//! \throw	None.
+//!
+//! \returns	std_uint	The checksum.
+//!
+//! \see	JOURNAL_CHECKSUM_BASIS
+//! \see	JOURNAL_CHECKSUM_PRIME
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+INLINE	std_uint	VoteJournal::ComputeChecksum(register const byte* Buffer,
+				register std_uint Length) noexcept
+	{
+	register	std_uint	Checksum;
+
+	for (Checksum = JOURNAL_CHECKSUM_BASIS; Length > 0; --Length)
+		Checksum = (Checksum ^ *Buffer++) * JOURNAL_CHECKSUM_PRIME;
+	return Checksum;
+	}
+
+////////////////////////////////////////////////////////////////////////////////
+//! \par	Description:
+//!	Default constructor
+//!
+//! \throw	utility_space::OUT_OF_MEMORY	If memory allocation fails.
+//!
+//! \returns	Not applicable.
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+INLINE	VoteJournal::VoteJournal(void) throw(FatalException): File(),
+		Candidates(0), VotesBlocks(0), SignatureBlocks(
+		Cryptography::ComputeBlocks(2 * SIGNATURE_LENGTH)),
+		EntryLength(0), Entries(0), Encoder(), PendingEntries(),
+		EntryBuffer(), AppliedVote(), AppliedVotes()
+	{
+	}
+
+////////////////////////////////////////////////////////////////////////////////
+//! \par	Description:
+//!	Destructor; if the file is still open, the function closes it and
+//!	throws an exception.
+//!
+//! \throw	utility_space::OUT_OF_MEMORY	If memory allocation fails when
+//!						creating an exception.
+//! \throw	io_space::FILE_CLOSE_ERROR	If the File is open and an error
+//!						occurs while closing it.
+//! \throw	io_space::FILE_NOT_CLOSED	If the File is open.
+//!
+//! \returns	Not applicable.
+//!
+//! \note
+//!	The exception could be thrown when the File is destroyed while
+//!	processing another exception, thrown but not yet caught.
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+INLINE	VoteJournal::~VoteJournal(void) throw(FatalException, IOException)
+	{
+	}
+
+////////////////////////////////////////////////////////////////////////////////
+//! \par	Description:
+//!	Get the number of entries written into the file.
+//!
+//! \throw	None.
+//!
+//! \returns	std_uint	The number of entries.
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+INLINE	std_uint	VoteJournal::GetEntries(void) const noexcept
+	{
+	return Entries;
+	}
+
+}
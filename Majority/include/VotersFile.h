@@ -64,13 +64,15 @@ class	VotersFile: private File
 		void		Create(const CharString& thisPathName,
 					register std_uint Voters,
 					const byte Key [ENCRYPTION_KEY_LENGTH],
+					std_uint Engine,
 					register RandomGenerator& Generator)
 					throw(FatalException, IOException);
 
 		void		Read(const CharString& thisPathName,
 					register std_uint Voters,
 					register Vector<std_uint>& VoterIndex,
-					const byte Key [ENCRYPTION_KEY_LENGTH])
+					const byte Key [ENCRYPTION_KEY_LENGTH],
+					std_uint Engine)
 					throw(FatalException, IOException,
 					ApplicationException);
 
@@ -20,9 +20,17 @@
 # include	"ApplicationException.h"
 # include	"File.h"
 # include	"Vector.h"
-# include	"OrderedVector.h"
+# include	"Set.h"
 # include	"RandomGenerator.h"
 # include	"Cryptography.h"
+# include	"RecordLockTable.h"
+# include	"RecordGenerationTable.h"
+# include	"ElectionTally.h"
+
+//! \def	REWRITE_BUFFER_SIZE
+//!	Size of the buffer used to rewrite a group of records with a few system
+//!	calls; a record longer than the buffer is rewritten alone.
+# define	REWRITE_BUFFER_SIZE		(1024 * 1024)
 
 namespace	io_space
 {
@@ -62,16 +70,59 @@ struct	VoteData: public SimpleVoteData
 using	namespace	utility_space;
 using	namespace	application_space;
 
+static_assert(2 * SIGNATURE_LENGTH <=
+	CRYPTOGRAPHY_BUFFER_BLOCKS * ENCRYPTION_BLOCK_LENGTH,
+	"Wrong CRYPTOGRAPHY_BUFFER_BLOCKS, less than the signature length");
+
+////////////////////////////////////////////////////////////////////////////////
+//! \struct	VotesShard
+//!	The VotesShard struct contains the data about one of the files the votes
+//!	are split into.
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+struct	VotesShard
+	{
+//! \property	Records
+//!	File containing the records of the voters of the shard.
+	File			Records;
+
+//! \property	FirstVoter
+//!	Index of the first voter of the shard.
+	std_uint		FirstVoter;
+
+//! \property	Voters
+//!	Number of voters of the shard.
+	std_uint		Voters;
+
+//! \property	MappedRecords
+//!	Address of the records of the file mapped in memory, or nullptr if the
+//!	file is not mapped.
+	byte*			MappedRecords;
+
+//! \property	Transfers
+//!	Number of transfers of the group being rewritten that refer to the
+//!	shard, when batches of transfers are asynchronous.
+	std_uint		Transfers;
+	};
+
 ////////////////////////////////////////////////////////////////////////////////
 //! \class	VotesFile
-//!	The VotesFile class represents a File containing the votes.
+//!	The VotesFile class represents the files containing the votes.
+//!
+//! \note
+//!	The records are split into one or more shards, each one containing the
+//!	records of a range of adjacent voters in its own file; the first shard
+//!	is stored in the file with the given path name, shard i in the file with
+//!	the given path name followed by i, so that a votes file created before
+//!	the shards were introduced is a single shard.
 //!
 //! \fileformat
 //! \see	VotersFileFormat
 //!
 ////////////////////////////////////////////////////////////////////////////////
 
-class	VotesFile: private File
+class	VotesFile
 	{
 	private:
 
@@ -83,6 +134,14 @@ class	VotesFile: private File
 //!	Number of voters.
 			std_uint		Voters;
 
+//! \property	ShardCount
+//!	Number of shards.
+			std_uint		ShardCount;
+
+//! \property	Shards
+//!	Array containing the shards.
+			VotesShard		Shards [MAXIMUM_SHARDS];
+
 //! \property	MaximumVote
 //!	Maximum possible vote.
 			std_uint		MaximumVote;
@@ -99,6 +158,10 @@ class	VotesFile: private File
 //!	Number of cryptography blocks used for the signature.
 			std_uint		SignatureBlocks;
 
+//! \property	DecoyVotes
+//!	Minimum number of votes modified when a vote is written.
+			std_uint		DecoyVotes;
+
 //! \property	IndexGenerator
 //!	Random number generator used to select indices of votes to be modified.
 //!
@@ -113,13 +176,46 @@ class	VotesFile: private File
 //!	Encoder used to crypt and decrypt the file.
 			Cryptography		Encoder;
 
-//! \property	RandomIndex
-//!	Array containing the random indices of votes to be modified.
-			Vector<std_uint>	RandomIndex;
+//! \property	RecordSet
+//!	Set of the indices of the records modified by the operation being
+//!	performed.
+			Set<std_uint>		RecordSet;
 
-//! \property	OrderedIndex
-//!	OrderedArray containing the random indices of votes to be modified.
-			OrderedVector<std_uint>	OrderedIndex;
+//! \property	RewriteIndex
+//!	Array containing the distinct indices of the records to be rewritten, in
+//!	increasing order.
+			Vector<std_uint>	RewriteIndex;
+
+//! \property	RewriteVotes
+//!	Array containing the pointers to the votes to be written into the
+//!	records being rewritten, in increasing order of voter.
+			Vector<const VoteData*>	RewriteVotes;
+
+//! \property	RewriteBuffer
+//!	Buffer containing a group of records being rewritten.
+//!
+//! \see	REWRITE_BUFFER_SIZE
+			Vector<byte>		RewriteBuffer;
+
+//! \property	RewriteTransfers
+//!	Array containing the transfers of the runs of adjacent records being
+//!	rewritten, when batches of transfers are asynchronous.
+			Vector<BatchTransfer>	RewriteTransfers;
+
+//! \property	DirtyIndex
+//!	Array containing the indices of the voters whose mapped records have
+//!	been modified and not yet written to the disk.
+			Vector<std_uint>	DirtyIndex;
+
+//! \property	Locks
+//!	Table of the locks of the records shared by the processes modifying the
+//!	votes.
+			RecordLockTable		Locks;
+
+//! \property	Generations
+//!	Table of the generations of the votes shared by the processes modifying
+//!	and reading the votes.
+			RecordGenerationTable	Generations;
 
 					VotesFile(const VotesFile& Argument)
 						noexcept = delete;
@@ -133,18 +229,88 @@ class	VotesFile: private File
 			VotesFile&	operator = (VotesFile&& Argument)
 						noexcept = delete;
 
-			void		WriteSingleVote(register const VoteData&
+			void		SetShards(std_uint thisShardCount)
+						throw(FatalException);
+
+			std_uint	GetShard(std_uint Voter) const
+						noexcept;
+
+			std_ulong	GetOffset(std_uint Shard,
+						std_uint Voter) const noexcept;
+
+			std_uint	GetRunEnd(const Vector<std_uint>&
+						Index, std_uint First,
+						std_uint Last) const
+						throw(FatalException);
+
+			void		SelectRecords(const VoteData&
 						CurrentVote,
-						register RandomGenerator&
+						const byte VotersKey
+						[ENCRYPTION_KEY_LENGTH],
+						const byte VotesKey
+						[ENCRYPTION_KEY_LENGTH])
+						throw(FatalException);
+
+			void		AddRewriteVote(const VoteData*
+						CurrentVote)
+						throw(FatalException);
+
+			void		SortRecords(void)
+						throw(FatalException);
+
+			void		EncodeRecord(register byte* Record,
+						register const VoteData&
+						CurrentVote,
+						RandomGenerator&
+						FillerGenerator)
+						throw(FatalException);
+
+			void		RefreshRecord(register byte* Record,
+						RandomGenerator&
+						FillerGenerator)
+						throw(ApplicationException);
+
+			void		FillSignature(register byte* Signature,
+						RandomGenerator&
+						FillerGenerator) noexcept;
+
+			void		RewriteGroup(std_uint First,
+						std_uint Records,
+						std_uint& NextVote,
+						RandomGenerator&
 						FillerGenerator)
 						throw(FatalException,
+						IOException,
+						ApplicationException);
+
+			void		RewriteRecords(RandomGenerator&
+						FillerGenerator)
+						throw(FatalException,
+						IOException,
+						ApplicationException);
+
+			void		WriteBlocks(File& Records,
+						byte* Buffer, std_uint Blocks)
+						throw(FatalException,
 						IOException);
 
-		static	byte		MakeVote(std_uint Vote,
-						RandomGenerator& Generator)
-						noexcept;
+			void		LoadBlocks(std_uint Shard,
+						byte* Buffer,
+						std_ulong Offset,
+						std_uint Blocks)
+						throw(FatalException,
+						IOException);
 
-		static	std_uint	GetVote(byte EncodedVote) noexcept;
+			void		StoreBlocks(std_uint Shard,
+						std_ulong Offset,
+						byte* Buffer,
+						std_uint Blocks)
+						throw(FatalException,
+						IOException);
+
+		static	CharString	MakeShardPathName(const CharString&
+						PathName, std_uint Shard)
+						throw(FatalException);
 
 	public:
 
@@ -156,9 +322,11 @@ class	VotesFile: private File
 			void		Create(const CharString& thisPathName,
 						register std_uint
 						thisCandidates,
-						register std_uint Voters,
+						std_uint thisVoters,
+						std_uint thisShardCount,
 						const byte Key
 						[ENCRYPTION_KEY_LENGTH],
+						std_uint Engine,
 						register RandomGenerator&
 						Generator) throw(FatalException,
 						IOException);
@@ -167,12 +335,30 @@ class	VotesFile: private File
 						std_uint thisCandidates,
 						std_uint thisVoters,
 						std_uint thisMaximumVote,
+						std_uint thisShardCount,
 						const byte Key
-						[ENCRYPTION_KEY_LENGTH])
+						[ENCRYPTION_KEY_LENGTH],
+						std_uint Engine)
+						throw(FatalException,
+						IOException,
+						ApplicationException);
+
+			void		OpenLocks(const CharString&
+						LocksPathName)
 						throw(FatalException,
 						IOException,
 						ApplicationException);
 
+			void		OpenGenerations(const CharString&
+						GenerationsPathName)
+						throw(FatalException,
+						IOException,
+						ApplicationException);
+
+			void		SetDecoyVotes(std_uint
+						thisDecoyVotes)
+						throw(FatalException);
+
 			void		Read(std_uint Voter,
 						register Vector<std_uint>& Vote)
 						throw(FatalException,
@@ -185,6 +371,24 @@ class	VotesFile: private File
 						IOException,
 						ApplicationException);
 
+			std_uint	CountVotes(std_uint FirstVoter,
+						std_uint LastVoter,
+						ElectionTally& ElectionVote)
+						throw(FatalException,
+						IOException,
+						ApplicationException);
+
+			void		RefreshVotes(std_uint FirstVoter,
+						std_uint LastVoter,
+						ElectionTally& ElectionVote,
+						std_uint& Votes,
+						Vector<std_uint>&
+						VoterGenerations,
+						Vector<byte>& Ballots)
+						throw(FatalException,
+						IOException,
+						ApplicationException);
+
 			void		WriteVote(const VoteData& CurrentVote,
 						const byte VotersKey
 						[ENCRYPTION_KEY_LENGTH],
@@ -196,15 +400,45 @@ class	VotesFile: private File
 						IOException,
 						ApplicationException);
 
+			void		WriteVotes(const VoteData* Votes,
+						std_uint Count,
+						const byte VotersKey
+						[ENCRYPTION_KEY_LENGTH],
+						const byte VotesKey
+						[ENCRYPTION_KEY_LENGTH],
+						register RandomGenerator&
+						FillerGenerator)
+						throw(FatalException,
+						IOException,
+						ApplicationException);
+
 			void		Modify(std_uint Voter, RandomGenerator&
 						FillerGenerator)
 						throw(FatalException,
 						IOException,
 						ApplicationException);
 
-			using		File::Close;
+			void		Sweep(std_uint Records,
+						RandomGenerator&
+						FillerGenerator)
+						throw(FatalException,
+						IOException,
+						ApplicationException);
+
+			void		Close(void)
+						throw(FatalException,
+						IOException);
 
-			using		File::SystemFlush;
+			void		SystemFlush(void)
+						throw(FatalException,
+						IOException);
+
+		static	void		MakeVotes(byte* Destination,
+						std_uint Length,
+						RandomGenerator& Generator)
+						noexcept;
+
+		static	std_uint	GetVote(byte EncodedVote) noexcept;
 
 	};
 
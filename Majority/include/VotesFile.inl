@@ -18,25 +18,29 @@ using	namespace	utility_space;
 
 ////////////////////////////////////////////////////////////////////////////////
 //! \par	Description:
-//!	Create a byte containg a vote and a random filler.
+//!	Fill a buffer with bytes containing a zero vote and a random filler;
+//!	adding a vote to a byte gives the byte containing the vote.
 //!
-//! \param	Vote		The vote.
+//! \param	Destination	The buffer.
+//! \param	Length		The number of bytes to fill.
 //! \param	Generator	Reference to the random number generator used to
 //!				generate random record fillers.
 //!
 //! \throw	None.
 //!
-//! \returns	byte		The random data filled vote.
+//! \returns	None.
 //!
 //! \see	MAXIMUM_VOTE
 //!
 ////////////////////////////////////////////////////////////////////////////////
 
-INLINE	byte	VotesFile::MakeVote(std_uint Vote, RandomGenerator& Generator)
+INLINE	void	VotesFile::MakeVotes(register byte* Destination,
+			register std_uint Length, RandomGenerator& Generator)
 			noexcept
 	{
-	return static_cast<byte>(Generator.Generate(BYTE_MAX /
-		(MAXIMUM_VOTE + 1)) * (MAXIMUM_VOTE + 1) + Vote);
+	Generator.Fill(Destination, Length, BYTE_MAX / (MAXIMUM_VOTE + 1));
+	for (; Length > 0; --Length)
+		*Destination++ *= MAXIMUM_VOTE + 1;
 	}
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -59,6 +63,212 @@ INLINE	std_uint	VotesFile::GetVote(byte EncodedVote) noexcept
 	return EncodedVote % (MAXIMUM_VOTE + 1);
 	}
 
+////////////////////////////////////////////////////////////////////////////////
+//! \par	Description:
+//!	Get the shard containing the record of a voter.
+//!
+//! \param	Voter		The index of the voter.
+//!
+//! \throw	None.
+//!
+//! \returns	std_uint	The index of the shard.
+//!
+//! \note
+//!	The shards have balanced ranges of voters, so that the proportional
+//!	estimate is at most one shard away from the right one.
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+INLINE	std_uint	VotesFile::GetShard(std_uint Voter) const noexcept
+	{
+	register	std_uint	Shard;
+
+	Shard = static_cast<std_uint>(static_cast<std_ulong>(Voter) *
+		ShardCount / Voters);
+	while (Voter < Shards [Shard].FirstVoter)
+		--Shard;
+	while (Voter >= Shards [Shard].FirstVoter + Shards [Shard].Voters)
+		++Shard;
+	return Shard;
+	}
+
+////////////////////////////////////////////////////////////////////////////////
+//! \par	Description:
+//!	Get the position of the record of a voter in the file of its shard.
+//!
+//! \param	Shard		The index of the shard.
+//! \param	Voter		The index of the voter.
+//!
+//! \throw	None.
+//!
+//! \returns	std_ulong	The position of the record.
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+INLINE	std_ulong	VotesFile::GetOffset(std_uint Shard, std_uint Voter)
+				const noexcept
+	{
+	return static_cast<std_ulong>(Voter - Shards [Shard].FirstVoter) *
+		RecordLength;
+	}
+
+////////////////////////////////////////////////////////////////////////////////
+//! \par	Description:
+//!	Find the end of a run of adjacent voters in an ordered array of indices
+//!	of voters; a run never crosses the boundary of a shard.
+//!
+//! \param	Index				Reference to the array.
+//! \param	First				The position in the array of
+//!						the first voter of the run.
+//! \param	Last				The position in the array past
+//!						the last voter to consider.
+//!
+//! \throw	utility_space::OUT_OF_MEMORY	If memory allocation fails when
+//!						creating an exception.
+//! \throw	utility_space::ILLEGAL_ARGUMENT	If a position is outside the
+//!						array.
+//!
+//! \returns	std_uint			The position in the array past
+//!						the last voter of the run.
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+INLINE	std_uint	VotesFile::GetRunEnd(
+				register const Vector<std_uint>& Index,
+				std_uint First, register std_uint Last) const
+				throw(FatalException)
+	{
+	register	std_uint	Next;
+	register	std_uint	ShardEnd;
+	register	std_uint	Shard;
+
+	Shard = GetShard(Index [First]);
+	ShardEnd = Shards [Shard].FirstVoter + Shards [Shard].Voters;
+	for (Next = First + 1; Next < Last and Index [Next] < ShardEnd and
+		Index [Next] == Index [Next - 1] + 1; ++Next)
+		;
+	return Next;
+	}
+
+////////////////////////////////////////////////////////////////////////////////
+//! \par	Description:
+//!	Crypt a sequence of blocks and write them at the current position of the
+//!	file of a shard.
+//!
+//! \param	Records				Reference to the file.
+//! \param	Buffer				The array of blocks to be
+//!						written; upon return it will
+//!						contain the encrypted blocks.
+//! \param	Blocks				The number of blocks.
+//!
+//! \throw	utility_space::OUT_OF_MEMORY	If memory allocation fails.
+//! \throw	io_space::FILE_NOT_OPEN		If the File is not opened.
+//! \throw	io_space::FILE_WRITE_ERROR	If an error occurs while
+//!						writing.
+//!
+//! \returns	None.
+//!
+//! \see	ENCRYPTION_BLOCK_LENGTH
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+INLINE	void	VotesFile::WriteBlocks(File& Records, byte* Buffer,
+			std_uint Blocks) throw(FatalException, IOException)
+	{
+	Encoder.CryptBlocks(Buffer, Buffer, Blocks);
+	Records.Write(Buffer, ENCRYPTION_BLOCK_LENGTH, Blocks);
+	}
+
+////////////////////////////////////////////////////////////////////////////////
+//! \par	Description:
+//!	Decrypt a sequence of blocks from a given position of the file of a
+//!	shard.
+//!
+//! \param	Shard				The index of the shard.
+//! \param	Buffer				The array that upon return will
+//!						contain the decrypted blocks.
+//! \param	Offset				The position of the first block
+//!						in the file of the shard.
+//! \param	Blocks				The number of blocks.
+//!
+//! \throw	utility_space::OUT_OF_MEMORY	If memory allocation fails.
+//! \throw	io_space::FILE_NOT_OPEN		If the File is not opened.
+//! \throw	io_space::FILE_READ_ERROR	If an error occurs while
+//!						reading.
+//!
+//! \returns	None.
+//!
+//! \note
+//!	The blocks are decrypted directly from the mapped file, if possible.
+//!
+//! \see	ENCRYPTION_BLOCK_LENGTH
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+INLINE	void	VotesFile::LoadBlocks(std_uint Shard, byte* Buffer,
+			std_ulong Offset, std_uint Blocks)
+			throw(FatalException, IOException)
+	{
+	register	VotesShard&	CurrentShard = Shards [Shard];
+
+	if (CurrentShard.MappedRecords != nullptr)
+		Encoder.DecryptBlocks(CurrentShard.MappedRecords + Offset,
+			Buffer, Blocks);
+	else
+		{
+		if (CurrentShard.Records.ReadAt(Buffer, Blocks *
+			ENCRYPTION_BLOCK_LENGTH, Offset) < Blocks *
+			ENCRYPTION_BLOCK_LENGTH)
+			throw make_IO_exception(FILE_READ_ERROR,
+				CurrentShard.Records.GetPathName());
+		Encoder.DecryptBlocks(Buffer, Buffer, Blocks);
+		}
+	}
+
+////////////////////////////////////////////////////////////////////////////////
+//! \par	Description:
+//!	Crypt a sequence of blocks and store them at a given position of the
+//!	file of a shard.
+//!
+//! \param	Shard				The index of the shard.
+//! \param	Offset				The position of the first block
+//!						in the file of the shard.
+//! \param	Buffer				The array of blocks to be
+//!						stored; upon return its contents
+//!						are undefined.
+//! \param	Blocks				The number of blocks.
+//!
+//! \throw	utility_space::OUT_OF_MEMORY	If memory allocation fails.
+//! \throw	io_space::FILE_NOT_OPEN		If the File is not opened.
+//! \throw	io_space::FILE_WRITE_ERROR	If an error occurs while
+//!						writing.
+//!
+//! \returns	None.
+//!
+//! \note
+//!	The blocks are encrypted directly into the mapped file, if possible.
+//!
+//! \see	ENCRYPTION_BLOCK_LENGTH
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+INLINE	void	VotesFile::StoreBlocks(std_uint Shard, std_ulong Offset,
+			byte* Buffer, std_uint Blocks)
+			throw(FatalException, IOException)
+	{
+	register	VotesShard&	CurrentShard = Shards [Shard];
+
+	if (CurrentShard.MappedRecords != nullptr)
+		Encoder.CryptBlocks(Buffer, CurrentShard.MappedRecords + Offset,
+			Blocks);
+	else
+		{
+		Encoder.CryptBlocks(Buffer, Buffer, Blocks);
+		CurrentShard.Records.WriteAt(Buffer, Blocks *
+			ENCRYPTION_BLOCK_LENGTH, Offset);
+		}
+	}
+
 ////////////////////////////////////////////////////////////////////////////////
 //! \par	Description:
 //!	Default constructor
@@ -71,18 +281,25 @@ INLINE	std_uint	VotesFile::GetVote(byte EncodedVote) noexcept
 //!
 ////////////////////////////////////////////////////////////////////////////////
 
-INLINE	VotesFile::VotesFile(void) throw(FatalException): File(), Candidates(0),
-		Voters(0), MaximumVote(0), RecordLength(0), VotesBlocks(0),
-		SignatureBlocks(Cryptography::ComputeBlocks(2 *
-		SIGNATURE_LENGTH)), IndexGenerator(), Encoder(),
-		RandomIndex(RANDOM_VOTES + 1)
+INLINE	VotesFile::VotesFile(void) throw(FatalException): Candidates(0),
+		Voters(0), ShardCount(0), Shards(), MaximumVote(0),
+		RecordLength(0), VotesBlocks(0), SignatureBlocks(
+		Cryptography::ComputeBlocks(2 * SIGNATURE_LENGTH)),
+		DecoyVotes(RANDOM_VOTES), IndexGenerator(),
+		Encoder(), RecordSet(RANDOM_VOTES + RANDOM_VOTES / 2 + 1),
+		RewriteIndex(), RewriteVotes(), RewriteBuffer(),
+		RewriteTransfers(), DirtyIndex(), Locks()
 	{
+	register	std_uint	Shard;
+
+	for (Shard = 0; Shard < MAXIMUM_SHARDS; ++Shard)
+		Shards [Shard].MappedRecords = nullptr;
 	}
 
 ////////////////////////////////////////////////////////////////////////////////
 //! \par	Description:
-//!	Destructor; if the file is still open, the function closes it and
-//!	throws an exception.
+//!	Destructor; if the files of the shards are still open, the function
+//!	removes their mappings, closes them and throws an exception.
 //!
 //! \throw	utility_space::OUT_OF_MEMORY	If memory allocation fails when
 //!						creating an exception.
@@ -100,6 +317,45 @@ INLINE	VotesFile::VotesFile(void) throw(FatalException): File(), Candidates(0),
 
 INLINE	VotesFile::~VotesFile(void) throw(FatalException, IOException)
 	{
+	register	std_uint	Shard;
+
+	for (Shard = 0; Shard < ShardCount; ++Shard)
+		if (Shards [Shard].MappedRecords != nullptr)
+			Shards [Shard].Records.Unmap(
+				Shards [Shard].MappedRecords,
+				static_cast<std_ulong>(Shards [Shard].Voters) *
+				RecordLength);
+	}
+
+////////////////////////////////////////////////////////////////////////////////
+//! \par	Description:
+//!	Set the minimum number of votes modified when a vote is written.
+//!
+//! \param	thisDecoyVotes			The number of votes.
+//!
+//! \throw	utility_space::OUT_OF_MEMORY	If memory allocation fails when
+//!						creating an exception.
+//! \throw	utility_space::ILLEGAL_ARGUMENT	If the number of votes is
+//!						outside the valid range.
+//!
+//! \returns	None.
+//!
+//! \note
+//!	The value must be the same for all the processes writing the votes of
+//!	an election, so that a voter voting again modifies the same votes.
+//!
+//! \see	MINIMUM_DECOY_VOTES
+//! \see	RANDOM_VOTES
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+INLINE	void	VotesFile::SetDecoyVotes(std_uint thisDecoyVotes)
+			throw(FatalException)
+	{
+	if (thisDecoyVotes < MINIMUM_DECOY_VOTES or
+		thisDecoyVotes > RANDOM_VOTES)
+		throw make_fatal_exception(ILLEGAL_ARGUMENT);
+	DecoyVotes = thisDecoyVotes;
 	}
 
 }
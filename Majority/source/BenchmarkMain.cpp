@@ -0,0 +1,851 @@
+////////////////////////////////////////////////////////////////////////////////
+//! \file
+//!
+//! \author	agent
+//!
+//! \date	16/10/2026
+//!
+//! \par	Function:
+//!	Contains the definition of static data and functions of the
+//!	cryptography benchmark program.
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+# include	<stdio.h>
+# include	<stdlib.h>
+# include	<string.h>
+
+# include	"Standard.h"
+# include	"Parameter.h"
+# include	"Message.h"
+# include	"FatalException.h"
+# include	"IOException.h"
+# include	"ApplicationException.h"
+# include	"ExceptionHandler.h"
+# include	"SystemManager.h"
+# include	"File.h"
+# include	"Cryptography.h"
+# include	"RandomGenerator.h"
+# include	"Utility.h"
+
+# if COMPILER == GNU_4
+# include	<x86intrin.h>
+# endif
+
+//! \def	DEFAULT_BENCHMARK_BLOCKS
+//!	Default number of blocks encrypted and decrypted by each benchmark.
+# define	DEFAULT_BENCHMARK_BLOCKS	(1 << 20)
+
+//! \def	MINIMUM_BENCHMARK_BLOCKS
+//!	Minimum number of blocks encrypted and decrypted by each benchmark.
+# define	MINIMUM_BENCHMARK_BLOCKS	BENCHMARK_BUFFER_BLOCKS
+
+//! \def	MAXIMUM_BENCHMARK_BLOCKS
+//!	Maximum number of blocks encrypted and decrypted by each benchmark.
+# define	MAXIMUM_BENCHMARK_BLOCKS	(1 << 30)
+
+//! \def	BENCHMARK_BUFFER_BLOCKS
+//!	Number of blocks of the buffer encrypted and decrypted repeatedly; it
+//!	is small enough to stay in the processor cache.
+# define	BENCHMARK_BUFFER_BLOCKS		4096
+
+//! \def	BENCHMARK_KEYS
+//!	Number of keys set by the key setting benchmark.
+# define	BENCHMARK_KEYS			10000
+
+//! \def	COLD_SAMPLES
+//!	Number of blocks encrypted by the cold and warm tables benchmarks.
+# define	COLD_SAMPLES			1000
+
+//! \def	EVICTION_BUFFER_SIZE
+//!	Size of the buffer written to evict the tables from the processor cache
+//!	before each sample of the cold tables benchmark.
+# define	EVICTION_BUFFER_SIZE		(16 << 20)
+
+//! \def	CACHE_LINE_SIZE
+//!	Size of a cache line of the processor.
+# define	CACHE_LINE_SIZE			64
+
+//! \def	SEQUENCE_BLOCKS
+//!	Number of distinct blocks of the sequence checked with CryptBlocks and
+//!	DecryptBlocks; it includes several groups of PARALLEL_BLOCKS blocks and
+//!	a remainder shorter than a group.
+# define	SEQUENCE_BLOCKS			(3 * PARALLEL_BLOCKS + 3)
+
+//! \def	SEQUENCE_MULTIPLIER
+//!	Multiplier of the index of each byte of the sequence of blocks and of
+//!	the key; it is odd, so that all the bytes of the sequence differ.
+# define	SEQUENCE_MULTIPLIER		151
+
+//! \def	SUB_STREAM_LENGTH
+//!	Number of bytes generated by each random number generator in the check
+//!	of the sub-streams.
+# define	SUB_STREAM_LENGTH		4096
+
+//! \def	SUB_STREAM_SEED
+//!	Seed of the selector of the random number generator split in the check
+//!	of the sub-streams; the seed of each linear generator is its index
+//!	multiplied by SEQUENCE_MULTIPLIER.
+# define	SUB_STREAM_SEED			12345
+
+static_assert(SEQUENCE_BLOCKS * ENCRYPTION_BLOCK_LENGTH <= BYTE_MAX + 1,
+	"The sequence of blocks is longer than the number of different bytes");
+
+using	namespace	utility_space;
+using	namespace	io_space;
+using	namespace	application_space;
+using	namespace	system_space;
+
+////////////////////////////////////////////////////////////////////////////////
+//! \struct	KnownAnswer
+//!	Known answer vector: the result of the encryption of a block with a
+//!	given key and engine, in hexadecimal notation.
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+struct	KnownAnswer
+	{
+//! \property	Engine
+//!	Identifier of the cipher engine.
+	std_uint	Engine;
+
+//! \property	Key
+//!	Encryption key.
+	const	char*	Key;
+
+//! \property	Plain
+//!	Plain block.
+	const	char*	Plain;
+
+//! \property	Encrypted
+//!	Encrypted block.
+	const	char*	Encrypted;
+	};
+
+//! \var	KnownAnswerTable
+//!	Table of known answer vectors. \n
+//!	The vectors are frozen: any change to the cipher engines must leave
+//!	them unchanged, otherwise existing elections cannot be read any more.
+static	const	KnownAnswer	KnownAnswerTable [] =
+	{
+		{
+		FEISTEL_ENGINE, "00000000000000000000000000000000",
+		"0000000000000000", "DAA8BB33554BC067"
+		},
+		{
+		FEISTEL_ENGINE, "00000000000000000000000000000000",
+		"FEDCBA9876543210", "BF3CFFCFFD764312"
+		},
+		{
+		FEISTEL_ENGINE, "00112233445566778899AABBCCDDEEFF",
+		"0123456789ABCDEF", "1E234E45E549F189"
+		},
+		{
+		FEISTEL_ENGINE, "00112233445566778899AABBCCDDEEFF",
+		"FFFFFFFFFFFFFFFF", "3366658F27A6E8C9"
+		},
+		{
+		FEISTEL_ENGINE, "112233445566778899AABBCCDDEEFF00",
+		"FFFFFFFFFFFFFFFF", "6876F1EF57D67F6D"
+		},
+		{
+		FEISTEL_ENGINE, "112233445566778899AABBCCDDEEFF00",
+		"0123456789ABCDEF", "1D52E3F147E3721B"
+		},
+		{
+		FEISTEL_ENGINE, "0F1E2D3C4B5A69788796A5B4C3D2E1F0",
+		"FEDCBA9876543210", "0EBF800A8B3D51D0"
+		},
+		{
+		FEISTEL_ENGINE, "0F1E2D3C4B5A69788796A5B4C3D2E1F0",
+		"0000000000000000", "7332993689CBDEF0"
+		},
+		{
+		AES_ENGINE, "00000000000000000000000000000000",
+		"0000000000000000", "1C766AA20EA4C999"
+		},
+		{
+		AES_ENGINE, "00000000000000000000000000000000",
+		"FEDCBA9876543210", "316444647FFB5058"
+		},
+		{
+		AES_ENGINE, "00112233445566778899AABBCCDDEEFF",
+		"0123456789ABCDEF", "78310F57244AF84F"
+		},
+		{
+		AES_ENGINE, "00112233445566778899AABBCCDDEEFF",
+		"FFFFFFFFFFFFFFFF", "D4833F0479F4CB00"
+		},
+		{
+		AES_ENGINE, "112233445566778899AABBCCDDEEFF00",
+		"FFFFFFFFFFFFFFFF", "7F6C4CCA63D712A6"
+		},
+		{
+		AES_ENGINE, "112233445566778899AABBCCDDEEFF00",
+		"0123456789ABCDEF", "F6D30705F1A16484"
+		},
+		{
+		AES_ENGINE, "0F1E2D3C4B5A69788796A5B4C3D2E1F0",
+		"FEDCBA9876543210", "1596743A4F3B91A9"
+		},
+		{
+		AES_ENGINE, "0F1E2D3C4B5A69788796A5B4C3D2E1F0",
+		"0000000000000000", "E82C84B37C583513"
+		}
+	};
+
+//! \var	EngineName
+//!	Names of the cipher engines, indexed by engine identifier.
+static	const	char*	const	EngineName [MAXIMUM_ENGINE + 1] =
+	{
+	FEISTEL_ENGINE_NAME,
+	AES_ENGINE_NAME
+	};
+
+//! \var	Buffer
+//!	Buffer of blocks encrypted and decrypted by the benchmarks.
+static	byte	Buffer [BENCHMARK_BUFFER_BLOCKS * ENCRYPTION_BLOCK_LENGTH];
+
+//! \var	EvictionBuffer
+//!	Buffer written to evict the tables from the processor cache.
+static	byte	EvictionBuffer [EVICTION_BUFFER_SIZE];
+
+static	void		Usage(void) throw(IOException);
+
+static	std_ulong	GetCycles(void) noexcept;
+
+static	std_ulong	GetTime(void) noexcept;
+
+static	void		PrintResult(std_uint Engine, const char* Operation,
+				std_ulong Blocks, std_ulong Time,
+				std_ulong Cycles) throw(IOException);
+
+static	bool		CheckKnownAnswers(void)
+				throw(FatalException, IOException,
+				ApplicationException);
+
+static	bool		CheckBlockSequences(void) throw(FatalException,
+				IOException);
+
+static	bool		CheckSubStreams(void) throw(FatalException,
+				IOException);
+
+static	void		MeasureSetKey(std_uint Engine) throw(FatalException,
+				IOException);
+
+static	void		MeasureThroughput(std_uint Engine, std_uint Blocks)
+				throw(FatalException, IOException);
+
+static	void		MeasureTables(std_uint Engine) throw(FatalException,
+				IOException);
+
+////////////////////////////////////////////////////////////////////////////////
+//! \par	Description:
+//!	Write on stdout a message explaining the usage of the program.
+//!
+//! \throw	io_space::FILE_WRITE_ERROR	If writing on stdout fails.
+//!
+//! \returns	None.
+//!
+//! \see	BENCHMARK_USAGE_FORMAT
+//! \see	DEFAULT_STDOUT_PATHNAME
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+static	void	Usage(void) throw(IOException)
+	{
+	if (printf(BENCHMARK_USAGE_FORMAT, MINIMUM_BENCHMARK_BLOCKS,
+		MAXIMUM_BENCHMARK_BLOCKS) < 0)
+		throw make_IO_exception(FILE_WRITE_ERROR,
+			CharString(DEFAULT_STDOUT_PATHNAME));
+	}
+
+////////////////////////////////////////////////////////////////////////////////
+//! \par	Description:
+//!	Read the time stamp counter of the processor.
+//!
+//! \throw	None.
+//!
+//! \returns	std_ulong	The number of cycles from an unspecified epoch,
+//!				or zero if the counter cannot be read.
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+static	std_ulong	GetCycles(void) noexcept
+	{
+# if COMPILER == GNU_4
+	return __rdtsc();
+# else
+	return 0;
+# endif
+	}
+
+////////////////////////////////////////////////////////////////////////////////
+//! \par	Description:
+//!	Read the system time.
+//!
+//! \throw	None.
+//!
+//! \returns	std_ulong	The time in nanoseconds from an unspecified
+//!				epoch.
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+static	std_ulong	GetTime(void) noexcept
+	{
+	return SystemManager::GetInstance()->GetSystemTime();
+	}
+
+////////////////////////////////////////////////////////////////////////////////
+//! \par	Description:
+//!	Print the result of an encryption or decryption benchmark.
+//!
+//! \param	Engine				Identifier of the cipher engine.
+//! \param	Operation			Name of the operation.
+//! \param	Blocks				Number of blocks processed.
+//! \param	Time				Elapsed time in nanoseconds.
+//! \param	Cycles				Elapsed processor cycles.
+//!
+//! \throw	io_space::FILE_WRITE_ERROR	If writing on stdout fails.
+//!
+//! \returns	None.
+//!
+//! \see	BENCHMARK_RESULT_FORMAT
+//! \see	NANOSECONDS_PER_SECOND
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+static	void	PrintResult(std_uint Engine, const char* Operation,
+			std_ulong Blocks, std_ulong Time, std_ulong Cycles)
+			throw(IOException)
+	{
+	if (Time == 0)
+		Time = 1;
+	if (printf(BENCHMARK_RESULT_FORMAT, EngineName [Engine], Operation,
+		static_cast<double>(Blocks) * NANOSECONDS_PER_SECOND / Time,
+		static_cast<double>(Cycles) /
+		(static_cast<double>(Blocks) * ENCRYPTION_BLOCK_LENGTH)) < 0)
+		throw make_IO_exception(FILE_WRITE_ERROR,
+			CharString(DEFAULT_STDOUT_PATHNAME));
+	}
+
+////////////////////////////////////////////////////////////////////////////////
+//! \par	Description:
+//!	Check the known answer vectors of all the cipher engines supported by
+//!	the processor. \n
+//!	Each vector is checked with Crypt and Decrypt and with CryptBlocks and
+//!	DecryptBlocks, on a sequence of copies of the block long enough to use
+//!	both the parallel and the single block implementations.
+//!
+//! \throw	utility_space::OUT_OF_MEMORY		If memory allocation
+//!							fails when creating an
+//!							exception.
+//! \throw	io_space::FILE_WRITE_ERROR		If writing on stdout
+//!							fails.
+//! \throw	application_space::INVALID_HEX_STRING	If a vector is not a
+//!							valid hexadecimal
+//!							string.
+//!
+//! \returns	bool					True, if all the vectors
+//!							are matched.
+//!
+//! \see	KnownAnswerTable
+//! \see	PARALLEL_BLOCKS
+//! \see	KNOWN_ANSWER_FORMAT
+//! \see	KNOWN_ANSWER_FAILURE_FORMAT
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+static	bool	CheckKnownAnswers(void)
+			throw(FatalException, IOException, ApplicationException)
+	{
+	register	std_uint	Index;
+	register	std_uint	Block;
+			std_uint	Checked;
+			std_uint	Failed;
+			std_uint	Skipped;
+			const char*	Failure;
+			Cryptography	Encoder;
+			byte		Key [ENCRYPTION_KEY_LENGTH];
+			byte		Plain [ENCRYPTION_BLOCK_LENGTH];
+			byte		Encrypted [ENCRYPTION_BLOCK_LENGTH];
+			byte		Result [ENCRYPTION_BLOCK_LENGTH];
+			byte		Blocks [(PARALLEL_BLOCKS + 1) *
+						ENCRYPTION_BLOCK_LENGTH];
+
+	Checked = Failed = Skipped = 0;
+	for (Index = 0; Index < number_of_elements(KnownAnswerTable); ++Index)
+		{
+		if (not Cryptography::IsEngineSupported(
+			KnownAnswerTable [Index].Engine))
+			{
+			++Skipped;
+			continue;
+			}
+		DecodeHex(KnownAnswerTable [Index].Key, Key, sizeof(Key));
+		DecodeHex(KnownAnswerTable [Index].Plain, Plain, sizeof(Plain));
+		DecodeHex(KnownAnswerTable [Index].Encrypted, Encrypted,
+			sizeof(Encrypted));
+		Encoder.SetEngine(KnownAnswerTable [Index].Engine);
+		Encoder.SetKey(Key);
+		Failure = nullptr;
+		Encoder.Crypt(Plain, Result);
+		if (memcmp(Result, Encrypted, sizeof(Result)) != 0)
+			Failure = "Crypt";
+		Encoder.Decrypt(Encrypted, Result);
+		if (memcmp(Result, Plain, sizeof(Result)) != 0)
+			Failure = "Decrypt";
+		for (Block = 0; Block <= PARALLEL_BLOCKS; ++Block)
+			ignore_value(memcpy(Blocks + Block *
+				ENCRYPTION_BLOCK_LENGTH, Plain, sizeof(Plain)));
+		Encoder.CryptBlocks(Blocks, Blocks, PARALLEL_BLOCKS + 1);
+		for (Block = 0; Block <= PARALLEL_BLOCKS; ++Block)
+			if (memcmp(Blocks + Block * ENCRYPTION_BLOCK_LENGTH,
+				Encrypted, sizeof(Encrypted)) != 0)
+				Failure = "CryptBlocks";
+		Encoder.DecryptBlocks(Blocks, Blocks, PARALLEL_BLOCKS + 1);
+		for (Block = 0; Block <= PARALLEL_BLOCKS; ++Block)
+			if (memcmp(Blocks + Block * ENCRYPTION_BLOCK_LENGTH,
+				Plain, sizeof(Plain)) != 0)
+				Failure = "DecryptBlocks";
+		++Checked;
+		if (Failure != nullptr)
+			{
+			++Failed;
+			if (printf(KNOWN_ANSWER_FAILURE_FORMAT, Index,
+				Failure) < 0)
+				throw make_IO_exception(FILE_WRITE_ERROR,
+					CharString(DEFAULT_STDOUT_PATHNAME));
+			}
+		}
+	if (printf(KNOWN_ANSWER_FORMAT, Checked, Failed, Skipped) < 0)
+		throw make_IO_exception(FILE_WRITE_ERROR,
+			CharString(DEFAULT_STDOUT_PATHNAME));
+	return Failed == 0;
+	}
+
+////////////////////////////////////////////////////////////////////////////////
+//! \par	Description:
+//!	Check, for all the cipher engines supported by the processor, that
+//!	CryptBlocks and DecryptBlocks give the same results as Crypt and
+//!	Decrypt applied to each block. \n
+//!	The sequence is made of distinct blocks and includes both full groups
+//!	of PARALLEL_BLOCKS blocks and a remainder, so that a parallel
+//!	implementation that mixes or reorders the blocks of a group is detected.
+//!
+//! \throw	utility_space::OUT_OF_MEMORY	If memory allocation fails
+//!						when creating an exception.
+//! \throw	io_space::FILE_WRITE_ERROR	If writing on stdout fails.
+//!
+//! \returns	bool				True, if all the engines give
+//!						the same results.
+//!
+//! \see	SEQUENCE_BLOCKS
+//! \see	SEQUENCE_MULTIPLIER
+//! \see	BLOCK_SEQUENCE_FORMAT
+//! \see	BLOCK_SEQUENCE_FAILURE_FORMAT
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+static	bool	CheckBlockSequences(void) throw(FatalException, IOException)
+	{
+	register	std_uint	Engine;
+	register	std_uint	Index;
+			std_uint	Checked;
+			std_uint	Failed;
+			const char*	Failure;
+			Cryptography	Encoder;
+			byte		Key [ENCRYPTION_KEY_LENGTH];
+			byte		Plain [SEQUENCE_BLOCKS *
+						ENCRYPTION_BLOCK_LENGTH];
+			byte		Expected [sizeof(Plain)];
+			byte		Result [sizeof(Plain)];
+
+	for (Index = 0; Index < sizeof(Key); ++Index)
+		Key [Index] = static_cast<byte>(~(Index * SEQUENCE_MULTIPLIER));
+	for (Index = 0; Index < sizeof(Plain); ++Index)
+		Plain [Index] = static_cast<byte>(Index * SEQUENCE_MULTIPLIER);
+	Checked = Failed = 0;
+	for (Engine = 0; Engine <= MAXIMUM_ENGINE; ++Engine)
+		{
+		if (not Cryptography::IsEngineSupported(Engine))
+			continue;
+		Encoder.SetEngine(Engine);
+		Encoder.SetKey(Key);
+		Failure = nullptr;
+		for (Index = 0; Index < sizeof(Plain);
+			Index += ENCRYPTION_BLOCK_LENGTH)
+			Encoder.Crypt(Plain + Index, Expected + Index);
+		Encoder.CryptBlocks(Plain, Result, SEQUENCE_BLOCKS);
+		if (memcmp(Result, Expected, sizeof(Result)) != 0)
+			Failure = "CryptBlocks";
+		for (Index = 0; Index < sizeof(Plain);
+			Index += ENCRYPTION_BLOCK_LENGTH)
+			Encoder.Decrypt(Expected + Index, Result + Index);
+		if (memcmp(Result, Plain, sizeof(Result)) != 0)
+			Failure = "Decrypt";
+		Encoder.DecryptBlocks(Expected, Result, SEQUENCE_BLOCKS);
+		if (memcmp(Result, Plain, sizeof(Result)) != 0)
+			Failure = "DecryptBlocks";
+		++Checked;
+		if (Failure != nullptr)
+			{
+			++Failed;
+			if (printf(BLOCK_SEQUENCE_FAILURE_FORMAT,
+				EngineName [Engine], Failure) < 0)
+				throw make_IO_exception(FILE_WRITE_ERROR,
+					CharString(DEFAULT_STDOUT_PATHNAME));
+			}
+		}
+	if (printf(BLOCK_SEQUENCE_FORMAT, Checked, Failed) < 0)
+		throw make_IO_exception(FILE_WRITE_ERROR,
+			CharString(DEFAULT_STDOUT_PATHNAME));
+	return Failed == 0;
+	}
+
+////////////////////////////////////////////////////////////////////////////////
+//! \par	Description:
+//!	Check the sub-streams derived from a random number generator: the same
+//!	sub-stream must be reproduced by splitting the generator again, while
+//!	different sub-streams, and the generator itself, must generate
+//!	different numbers.
+//!
+//! \throw	utility_space::OUT_OF_MEMORY	If memory allocation fails
+//!						when creating an exception.
+//! \throw	io_space::FILE_WRITE_ERROR	If writing on stdout fails.
+//!
+//! \returns	bool				True, if all the checks are
+//!						passed.
+//!
+//! \see	SUB_STREAM_LENGTH
+//! \see	SUB_STREAM_SEED
+//! \see	SUB_STREAM_FORMAT
+//! \see	SUB_STREAM_FAILURE_FORMAT
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+static	bool	CheckSubStreams(void) throw(FatalException, IOException)
+	{
+	register	std_uint	Index;
+			std_uint	Checked;
+			std_uint	Failed;
+			const char*	Failure [3];
+			std_uint	Seed [LINEAR_GENERATORS];
+			RandomGenerator	Parent;
+			RandomGenerator	First;
+			RandomGenerator	Second;
+			RandomGenerator	Again;
+			byte		ParentBuffer [SUB_STREAM_LENGTH];
+			byte		FirstBuffer [SUB_STREAM_LENGTH];
+			byte		SecondBuffer [SUB_STREAM_LENGTH];
+			byte		AgainBuffer [SUB_STREAM_LENGTH];
+
+	for (Index = 0; Index < LINEAR_GENERATORS; ++Index)
+		Seed [Index] = Index * SEQUENCE_MULTIPLIER;
+	Parent.SetSeeds(SUB_STREAM_SEED, Seed);
+	Parent.Split(0, First);
+	Parent.Split(1, Second);
+	Parent.Split(0, Again);
+	Parent.Fill(ParentBuffer, sizeof(ParentBuffer), BYTE_MAX);
+	First.Fill(FirstBuffer, sizeof(FirstBuffer), BYTE_MAX);
+	Second.Fill(SecondBuffer, sizeof(SecondBuffer), BYTE_MAX);
+	Again.Fill(AgainBuffer, sizeof(AgainBuffer), BYTE_MAX);
+	Failure [0] = memcmp(FirstBuffer, AgainBuffer, sizeof(FirstBuffer)) !=
+		0 ? "not reproduced": nullptr;
+	Failure [1] = memcmp(FirstBuffer, SecondBuffer, sizeof(FirstBuffer)) ==
+		0 ? "equal sub-streams": nullptr;
+	Failure [2] = memcmp(FirstBuffer, ParentBuffer, sizeof(FirstBuffer)) ==
+		0 ? "equal to the parent": nullptr;
+	Checked = Failed = 0;
+	for (Index = 0; Index < number_of_elements(Failure); ++Index)
+		{
+		++Checked;
+		if (Failure [Index] != nullptr)
+			{
+			++Failed;
+			if (printf(SUB_STREAM_FAILURE_FORMAT, Failure [Index]) <
+				0)
+				throw make_IO_exception(FILE_WRITE_ERROR,
+					CharString(DEFAULT_STDOUT_PATHNAME));
+			}
+		}
+	if (printf(SUB_STREAM_FORMAT, Checked, Failed) < 0)
+		throw make_IO_exception(FILE_WRITE_ERROR,
+			CharString(DEFAULT_STDOUT_PATHNAME));
+	return Failed == 0;
+	}
+
+////////////////////////////////////////////////////////////////////////////////
+//! \par	Description:
+//!	Measure the cost of setting a key, that includes the computation of all
+//!	the values derived from the key.
+//!
+//! \param	Engine				Identifier of the cipher engine.
+//!
+//! \throw	utility_space::ILLEGAL_ARGUMENT	If the engine is not supported by
+//!					the processor.
+//! \throw	io_space::FILE_WRITE_ERROR	If writing on stdout fails.
+//!
+//! \returns	None.
+//!
+//! \see	BENCHMARK_KEYS
+//! \see	SET_KEY_RESULT_FORMAT
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+static	void	MeasureSetKey(std_uint Engine)
+			throw(FatalException, IOException)
+	{
+	register	std_uint	Index;
+			std_ulong	Time;
+			std_ulong	Cycles;
+			Cryptography	Encoder;
+			byte		Key [ENCRYPTION_KEY_LENGTH];
+
+	Encoder.SetEngine(Engine);
+	ignore_value(memset(Key, 0, sizeof(Key)));
+	Time = GetTime();
+	Cycles = GetCycles();
+	for (Index = 0; Index < BENCHMARK_KEYS; ++Index)
+		{
+		Unpack(Index, Key);
+		Encoder.SetKey(Key);
+		}
+	Cycles = GetCycles() - Cycles;
+	Time = GetTime() - Time;
+	if (Time == 0)
+		Time = 1;
+	if (printf(SET_KEY_RESULT_FORMAT, EngineName [Engine], "SetKey",
+		static_cast<double>(BENCHMARK_KEYS) * NANOSECONDS_PER_SECOND /
+		Time, static_cast<double>(Cycles) / BENCHMARK_KEYS) < 0)
+		throw make_IO_exception(FILE_WRITE_ERROR,
+			CharString(DEFAULT_STDOUT_PATHNAME));
+	}
+
+////////////////////////////////////////////////////////////////////////////////
+//! \par	Description:
+//!	Measure the throughput of encryption and decryption, both block by
+//!	block and in batches, with warm tables.
+//!
+//! \param	Engine				Identifier of the cipher engine.
+//! \param	Blocks				Number of blocks processed by each
+//!					measure.
+//!
+//! \throw	utility_space::ILLEGAL_ARGUMENT	If the engine is not supported by
+//!					the processor.
+//! \throw	io_space::FILE_WRITE_ERROR	If writing on stdout fails.
+//!
+//! \returns	None.
+//!
+//! \see	BENCHMARK_BUFFER_BLOCKS
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+static	void	MeasureThroughput(std_uint Engine, std_uint Blocks)
+			throw(FatalException, IOException)
+	{
+	register	std_uint	Index;
+	register	std_uint	Block;
+			std_ulong	Time;
+			std_ulong	Cycles;
+			Cryptography	Encoder;
+			byte		Key [ENCRYPTION_KEY_LENGTH];
+
+	Blocks -= Blocks % BENCHMARK_BUFFER_BLOCKS;
+	for (Index = 0; Index < sizeof(Key); ++Index)
+		Key [Index] = static_cast<byte>(Index);
+	for (Index = 0; Index < sizeof(Buffer); ++Index)
+		Buffer [Index] = static_cast<byte>(Index);
+	Encoder.SetEngine(Engine);
+	Encoder.SetKey(Key);
+	Encoder.CryptBlocks(Buffer, Buffer, BENCHMARK_BUFFER_BLOCKS);
+
+	Time = GetTime();
+	Cycles = GetCycles();
+	for (Index = 0; Index < Blocks; Index += BENCHMARK_BUFFER_BLOCKS)
+		for (Block = 0; Block < BENCHMARK_BUFFER_BLOCKS; ++Block)
+			Encoder.Crypt(Buffer + Block * ENCRYPTION_BLOCK_LENGTH,
+				Buffer + Block * ENCRYPTION_BLOCK_LENGTH);
+	Cycles = GetCycles() - Cycles;
+	Time = GetTime() - Time;
+	PrintResult(Engine, "Crypt", Blocks, Time, Cycles);
+
+	Time = GetTime();
+	Cycles = GetCycles();
+	for (Index = 0; Index < Blocks; Index += BENCHMARK_BUFFER_BLOCKS)
+		for (Block = 0; Block < BENCHMARK_BUFFER_BLOCKS; ++Block)
+			Encoder.Decrypt(Buffer + Block *
+				ENCRYPTION_BLOCK_LENGTH, Buffer + Block *
+				ENCRYPTION_BLOCK_LENGTH);
+	Cycles = GetCycles() - Cycles;
+	Time = GetTime() - Time;
+	PrintResult(Engine, "Decrypt", Blocks, Time, Cycles);
+
+	Time = GetTime();
+	Cycles = GetCycles();
+	for (Index = 0; Index < Blocks; Index += BENCHMARK_BUFFER_BLOCKS)
+		Encoder.CryptBlocks(Buffer, Buffer, BENCHMARK_BUFFER_BLOCKS);
+	Cycles = GetCycles() - Cycles;
+	Time = GetTime() - Time;
+	PrintResult(Engine, "CryptBlocks", Blocks, Time, Cycles);
+
+	Time = GetTime();
+	Cycles = GetCycles();
+	for (Index = 0; Index < Blocks; Index += BENCHMARK_BUFFER_BLOCKS)
+		Encoder.DecryptBlocks(Buffer, Buffer, BENCHMARK_BUFFER_BLOCKS);
+	Cycles = GetCycles() - Cycles;
+	Time = GetTime() - Time;
+	PrintResult(Engine, "DecryptBlocks", Blocks, Time, Cycles);
+	}
+
+////////////////////////////////////////////////////////////////////////////////
+//! \par	Description:
+//!	Measure the cost of encrypting a single block with cold tables, that
+//!	is, after evicting them from the processor cache, and with warm tables.
+//!
+//! \param	Engine				Identifier of the cipher engine.
+//!
+//! \throw	utility_space::ILLEGAL_ARGUMENT	If the engine is not supported by
+//!					the processor.
+//! \throw	io_space::FILE_WRITE_ERROR	If writing on stdout fails.
+//!
+//! \returns	None.
+//!
+//! \note
+//!	Only the encryption is measured, excluding the eviction.
+//!
+//! \see	COLD_SAMPLES
+//! \see	EVICTION_BUFFER_SIZE
+//! \see	CACHE_LINE_SIZE
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+static	void	MeasureTables(std_uint Engine)
+			throw(FatalException, IOException)
+	{
+	register	std_uint	Index;
+	register	std_uint	Sample;
+			std_ulong	Time;
+			std_ulong	Cycles;
+			std_ulong	StartTime;
+			std_ulong	StartCycles;
+			Cryptography	Encoder;
+			byte		Key [ENCRYPTION_KEY_LENGTH];
+
+	for (Index = 0; Index < sizeof(Key); ++Index)
+		Key [Index] = static_cast<byte>(Index);
+	Encoder.SetEngine(Engine);
+	Encoder.SetKey(Key);
+	Time = Cycles = 0;
+	for (Sample = 0; Sample < COLD_SAMPLES; ++Sample)
+		{
+		for (Index = 0; Index < EVICTION_BUFFER_SIZE;
+			Index += CACHE_LINE_SIZE)
+			++EvictionBuffer [Index];
+		StartTime = GetTime();
+		StartCycles = GetCycles();
+		Encoder.Crypt(Buffer, Buffer);
+		Cycles += GetCycles() - StartCycles;
+		Time += GetTime() - StartTime;
+		}
+	PrintResult(Engine, "Crypt cold", COLD_SAMPLES, Time, Cycles);
+	Time = Cycles = 0;
+	for (Sample = 0; Sample < COLD_SAMPLES; ++Sample)
+		{
+		StartTime = GetTime();
+		StartCycles = GetCycles();
+		Encoder.Crypt(Buffer, Buffer);
+		Cycles += GetCycles() - StartCycles;
+		Time += GetTime() - StartTime;
+		}
+	PrintResult(Engine, "Crypt warm", COLD_SAMPLES, Time, Cycles);
+	}
+
+////////////////////////////////////////////////////////////////////////////////
+//! \par	Description:
+//!	Main program for the cryptography benchmark. \n
+//!	It measures the cost of the setup of the tables shared by all
+//!	Cryptography objects, checks the known answer vectors, the sequences of
+//!	blocks and the sub-streams of the random number generator and then, for each cipher engine supported by the
+//!	processor, measures the cost of setting
+//!	a key, the throughput of encryption and decryption and the cost of
+//!	encryption with cold and warm tables.
+//!
+//! \param	argc	Number of command line arguments.
+//! \param	argv	Array of command line arguments.
+//!
+//! \throw	None.
+//!
+//! \returns	int	A code indicating whether the program terminated
+//!			correctly, all the known answer vectors were
+//!			matched, the sequences of blocks were processed
+//!			correctly and the sub-streams were checked or not.
+//!
+//! \see	DEFAULT_BENCHMARK_BLOCKS
+//! \see	MINIMUM_BENCHMARK_BLOCKS
+//! \see	MAXIMUM_BENCHMARK_BLOCKS
+//! \see	TABLE_SETUP_FORMAT
+//! \see	BENCHMARK_HEADER
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+int	main(int argc, char* argv [])
+	{
+	try
+		{
+		std_uint	Blocks;
+		std_uint	Engine;
+		std_ulong	Time;
+		std_ulong	Cycles;
+
+		HandleOptions(argc, argv);
+		if (argc > 2)
+			{
+			Usage();
+			return EXIT_FAILURE;
+			}
+		if (argc == 2)
+			{
+			Blocks = DecodeInteger(argv [1]);
+			if (Blocks < MINIMUM_BENCHMARK_BLOCKS or
+				Blocks > MAXIMUM_BENCHMARK_BLOCKS)
+				{
+				Usage();
+				return EXIT_FAILURE;
+				}
+			}
+		else
+			Blocks = DEFAULT_BENCHMARK_BLOCKS;
+		Time = GetTime();
+		Cycles = GetCycles();
+			{
+			Cryptography	Encoder;
+			}
+		Cycles = GetCycles() - Cycles;
+		Time = GetTime() - Time;
+		if (printf(TABLE_SETUP_FORMAT, Cycles, Time) < 0)
+			throw make_IO_exception(FILE_WRITE_ERROR,
+				CharString(DEFAULT_STDOUT_PATHNAME));
+		if (not CheckKnownAnswers())
+			return EXIT_FAILURE;
+		if (not CheckBlockSequences())
+			return EXIT_FAILURE;
+		if (not CheckSubStreams())
+			return EXIT_FAILURE;
+		if (printf(BENCHMARK_HEADER) < 0)
+			throw make_IO_exception(FILE_WRITE_ERROR,
+				CharString(DEFAULT_STDOUT_PATHNAME));
+		for (Engine = 0; Engine <= MAXIMUM_ENGINE; ++Engine)
+			if (Cryptography::IsEngineSupported(Engine))
+				{
+				MeasureSetKey(Engine);
+				MeasureThroughput(Engine, Blocks);
+				MeasureTables(Engine);
+				}
+		}
+	catch (ExceptionBase& Exc)
+		{
+		ExceptionHandler::GetInstance().HandleException(Exc);
+		}
+	return EXIT_SUCCESS;
+	}
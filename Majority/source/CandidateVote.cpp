@@ -1,18 +0,0 @@
-////////////////////////////////////////////////////////////////////////////////
-//! \file
-//!
-//! \author	Mauro Fiorentini
-//!
-//! \date	06/11/2018
-//!
-//!	It contains the definitions of static attributes and non inline
-//!	functions of the utility_space::CandidateVote class.
-//!
-////////////////////////////////////////////////////////////////////////////////
-
-# include	"Standard.h"
-# include	"CandidateVote.h"
-
-# if !defined	USE_INLINE
-# include	"CandidateVote.inl"
-# endif
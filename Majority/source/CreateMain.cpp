@@ -27,6 +27,9 @@
 # include	"RandomGenerator.h"
 # include	"VotersFile.h"
 # include	"VotesFile.h"
+# include	"RecordLockTable.h"
+# include	"RecordGenerationTable.h"
+# include	"VoteJournal.h"
 # include	"Utility.h"
 # include	"LocalUtility.h"
 
@@ -52,6 +55,12 @@ static	void	Usage(void) throw(IOException);
 //! \see	MAXIMUM_VOTERS
 //! \see	MINIMUM_VOTE
 //! \see	MAXIMUM_VOTE
+//! \see	MINIMUM_DECOY_VOTES
+//! \see	RANDOM_VOTES
+//! \see	MAXIMUM_SWEEP_VOTES
+//! \see	DEFAULT_SWEEP_VOTES
+//! \see	MAXIMUM_SHARDS
+//! \see	DEFAULT_SHARDS
 //! \see	DEFAULT_STDOUT_PATHNAME
 //!
 ////////////////////////////////////////////////////////////////////////////////
@@ -59,7 +68,10 @@ static	void	Usage(void) throw(IOException);
 static	void	Usage(void) throw(IOException)
 	{
 	if (printf(CREATE_USAGE_FORMAT, MINIMUM_CANDIDATES, MAXIMUM_CANDIDATES,
-		MINIMUM_VOTERS, MAXIMUM_VOTERS, MINIMUM_VOTE, MAXIMUM_VOTE) < 0)
+		MINIMUM_VOTERS, MAXIMUM_VOTERS, MINIMUM_VOTE, MAXIMUM_VOTE,
+		MINIMUM_DECOY_VOTES, RANDOM_VOTES, RANDOM_VOTES,
+		MAXIMUM_SWEEP_VOTES, DEFAULT_SWEEP_VOTES, MAXIMUM_SHARDS,
+		DEFAULT_SHARDS) < 0)
 		throw make_IO_exception(FILE_WRITE_ERROR,
 			CharString(DEFAULT_STDOUT_PATHNAME));
 	}
@@ -84,6 +96,12 @@ static	void	Usage(void) throw(IOException)
 //! \see	MAXIMUM_VOTERS
 //! \see	MINIMUM_VOTE
 //! \see	MAXIMUM_VOTE
+//! \see	MINIMUM_DECOY_VOTES
+//! \see	RANDOM_VOTES
+//! \see	MAXIMUM_SWEEP_VOTES
+//! \see	DEFAULT_SWEEP_VOTES
+//! \see	MAXIMUM_SHARDS
+//! \see	DEFAULT_SHARDS
 //! \see	ENCRYPTION_KEY_LENGTH
 //! \see	CREATION_FORMAT
 //! \see	DEFAULT_STDOUT_PATHNAME
@@ -97,6 +115,10 @@ int	main(int argc, char* argv [])
 		std_uint	Candidates;
 		std_uint	Voters;
 		std_uint	MaximumVote;
+		std_uint	Engine;
+		std_uint	DecoyVotes;
+		std_uint	SweepVotes;
+		std_uint	Shards;
 		char		EndOfLine;
 		CharString	DirectoryPath;
 		CharString	KeyPath;
@@ -105,11 +127,14 @@ int	main(int argc, char* argv [])
 		char		Buffer [4 * ENCRYPTION_KEY_LENGTH];
 		VotersFile	CurrentVotersFile;
 		VotesFile	CurrentVotesFile;
+		RecordLockTable	CurrentLockTable;
+		RecordGenerationTable	CurrentGenerationTable;
+		VoteJournal	CurrentJournal;
 		RandomGenerator	Generator;
 		File		ElectionFile;
 
 		HandleOptions(argc, argv);
-		if (argc != 6)
+		if (argc < 6 or argc > 9)
 			{
 			Usage();
 			return EXIT_FAILURE;
@@ -119,6 +144,18 @@ int	main(int argc, char* argv [])
 		Voters = DecodeInteger(argv [3]);
 		MaximumVote = DecodeInteger(argv [4]);
 		KeyPath = CharString(argv [5]);
+		if (argc > 6)
+			DecoyVotes = DecodeInteger(argv [6]);
+		else
+			DecoyVotes = RANDOM_VOTES;
+		if (argc > 7)
+			SweepVotes = DecodeInteger(argv [7]);
+		else
+			SweepVotes = DEFAULT_SWEEP_VOTES;
+		if (argc > 8)
+			Shards = DecodeInteger(argv [8]);
+		else
+			Shards = DEFAULT_SHARDS;
 		if (Candidates < MINIMUM_CANDIDATES or
 			Candidates > MAXIMUM_CANDIDATES)
 			throw make_application_exception(
@@ -127,13 +164,25 @@ int	main(int argc, char* argv [])
 			throw make_application_exception(INVALID_VOTERS_NUMBER);
 		if (MaximumVote < MINIMUM_VOTE or MaximumVote > MAXIMUM_VOTE)
 			throw make_application_exception(INVALID_MAXIMUM_VOTE);
+		if (DecoyVotes < MINIMUM_DECOY_VOTES or DecoyVotes > RANDOM_VOTES)
+			throw make_application_exception(INVALID_DECOY_VOTES);
+		if (SweepVotes == 0 or SweepVotes > MAXIMUM_SWEEP_VOTES)
+			throw make_application_exception(INVALID_SWEEP_VOTES);
+		if (Shards == 0 or Shards > MAXIMUM_SHARDS or Shards > Voters)
+			throw make_application_exception(INVALID_SHARDS);
 		ReadKeys(KeyPath, VotersKey, VotesKey);
 		InitializeGenerator(Generator, VotersKey, VotesKey);
+		Engine = Cryptography::GetPreferredEngine();
 		FileManager::GetInstance()->CreateDirectory(DirectoryPath);
 		CurrentVotersFile.Create(MakeVotersPathName(DirectoryPath),
-			Voters, VotersKey, Generator);
+			Voters, VotersKey, Engine, Generator);
 		CurrentVotesFile.Create(MakeVotesPathName(DirectoryPath),
-			Candidates, Voters, VotesKey, Generator);
+			Candidates, Voters, Shards, VotesKey, Engine,
+			Generator);
+		CurrentLockTable.Create(MakeLocksPathName(DirectoryPath));
+		CurrentGenerationTable.Create(MakeGenerationsPathName(
+			DirectoryPath), Voters);
+		CurrentJournal.Create(MakeJournalPathName(DirectoryPath));
 		EndOfLine = CharacterManager<char>:: GetEOLN();
 		ElectionFile.OpenText(MakeParametersPathName(DirectoryPath),
 			OPEN_WRITE);
@@ -143,12 +192,20 @@ int	main(int argc, char* argv [])
 		ElectionFile.WriteCharacter<char>(EndOfLine);
 		ElectionFile.WriteNumber<char>(MaximumVote);
 		ElectionFile.WriteCharacter<char>(EndOfLine);
-		EncodeKey(VotersKey, Buffer, Generator);
+		EncodeKey(VotersKey, Buffer, Generator, Engine);
 		ElectionFile.Write(Buffer, 1, 4 * ENCRYPTION_KEY_LENGTH);
 		ElectionFile.WriteCharacter<char>(EndOfLine);
-		EncodeKey(VotesKey, Buffer, Generator);
+		EncodeKey(VotesKey, Buffer, Generator, Engine);
 		ElectionFile.Write(Buffer, 1, 4 * ENCRYPTION_KEY_LENGTH);
 		ElectionFile.WriteCharacter<char>(EndOfLine);
+		ElectionFile.WriteNumber<char>(Engine);
+		ElectionFile.WriteCharacter<char>(EndOfLine);
+		ElectionFile.WriteNumber<char>(DecoyVotes);
+		ElectionFile.WriteCharacter<char>(EndOfLine);
+		ElectionFile.WriteNumber<char>(SweepVotes);
+		ElectionFile.WriteCharacter<char>(EndOfLine);
+		ElectionFile.WriteNumber<char>(Shards);
+		ElectionFile.WriteCharacter<char>(EndOfLine);
 		ElectionFile.Close();
 		if (printf(CREATE_FORMAT, Candidates, Voters, MaximumVote) < 0)
 			throw make_IO_exception(FILE_WRITE_ERROR,
@@ -21,7 +21,22 @@
 //!	Number of key shuffling steps
 # define	KEY_SHUFFLING_STEPS		8
 
-#include	<stdio.h>
+# if COMPILER == GNU_4
+
+# include	<immintrin.h>
+
+//! \def	AVX2_FUNCTION
+//!	Attribute used to compile a function using AVX2 instructions, whatever
+//!	the target processor.
+# define	AVX2_FUNCTION			__attribute__((target("avx2")))
+
+//! \def	AES_FUNCTION
+//!	Attribute used to compile a function using AES-NI instructions, whatever
+//!	the target processor.
+# define	AES_FUNCTION			__attribute__((target("aes,sse4.1")))
+
+# endif
+
 namespace	utility_space
 {
 
@@ -356,6 +371,291 @@ const	Cryptography::SBoxFunction	Cryptography::SubsFunctionTable
 	{ SBox_6, SBox_4, SBox_2, SBox_0 }
 	};
 
+std_uint	Cryptography::FusedTable [BYTE_FEISTEL_STEPS] [sizeof(std_uint)]
+			[BYTE_MAX + 1];
+
+# if COMPILER == GNU_4
+
+////////////////////////////////////////////////////////////////////////////////
+//! \par	Description:
+//!	Look up eight bytes in parallel into a table.
+//!
+//! \param	Source		Vector of eight std_uint; only the lowest byte
+//!				of each is used.
+//! \param	Table		The table.
+//!
+//! \throw	None.
+//!
+//! \returns	__m256i		The vector of the values found.
+//!
+//! \see	BYTE_MAX
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+AVX2_FUNCTION	LOCAL	inline	__m256i	ParallelLookUp(__m256i Source,
+					const std_uint Table [BYTE_MAX + 1])
+					noexcept
+	{
+	return _mm256_i32gather_epi32(reinterpret_cast<const int*>(Table),
+		_mm256_and_si256(Source, _mm256_set1_epi32(BYTE_MAX)),
+		sizeof(std_uint));
+	}
+
+////////////////////////////////////////////////////////////////////////////////
+//! \par	Description:
+//!	Execute a step of a Feistel function on eight blocks in parallel. \n
+//!	It is equivalent to executing Cryptography::FeistelStep on each block.
+//!
+//! \see	Cryptography::FusedTable
+//!
+//! \param	ConstantSource	The part of source data that is not changed.
+//! \param	ModifiedSource	Reference to the part of source data that is
+//!				changed.
+//! \param	LocalKey	Key used to xor the modified source data.
+//! \param	Table		Tables of the S-box functions composed with
+//!				bit diffusion, one for each byte.
+//!
+//! \throw	None.
+//!
+//! \returns	None
+//!
+//! \see	BYTE_BITS
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+AVX2_FUNCTION	LOCAL	inline	void	ParallelFeistelStep(
+					__m256i ConstantSource,
+					__m256i& ModifiedSource,
+					std_uint LocalKey,
+					const std_uint Table [sizeof(std_uint)]
+					[BYTE_MAX + 1]) noexcept
+	{
+	ConstantSource = _mm256_xor_si256(ConstantSource,
+		_mm256_set1_epi32(LocalKey));
+	ModifiedSource = _mm256_xor_si256(ModifiedSource,
+		ParallelLookUp(ConstantSource, Table [0]));
+	ModifiedSource = _mm256_xor_si256(ModifiedSource,
+		ParallelLookUp(_mm256_srli_epi32(ConstantSource, BYTE_BITS),
+		Table [1]));
+	ModifiedSource = _mm256_xor_si256(ModifiedSource,
+		ParallelLookUp(_mm256_srli_epi32(ConstantSource,
+		2 * BYTE_BITS), Table [2]));
+	ModifiedSource = _mm256_xor_si256(ModifiedSource,
+		ParallelLookUp(_mm256_srli_epi32(ConstantSource,
+		3 * BYTE_BITS), Table [3]));
+	}
+
+////////////////////////////////////////////////////////////////////////////////
+//! \par	Description:
+//!	Load eight blocks, separating the high and low halves.
+//!
+//! \param	Source		The array of blocks.
+//! \param	DataHigh	Reference to the vector that upon return will
+//!				contain the high halves.
+//! \param	DataLow		Reference to the vector that upon return will
+//!				contain the low halves.
+//!
+//! \throw	None.
+//!
+//! \returns	None.
+//!
+//! \note
+//!	Each half is packed as Pack does, as the processor is little endian.
+//!
+//! \see	PARALLEL_BLOCKS
+//! \see	ENCRYPTION_BLOCK_LENGTH
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+AVX2_FUNCTION	LOCAL	inline	void	ParallelLoad(const byte Source
+					[PARALLEL_BLOCKS *
+					ENCRYPTION_BLOCK_LENGTH],
+					__m256i& DataHigh, __m256i& DataLow)
+					noexcept
+	{
+	const	__m256i	Order = _mm256_setr_epi32(0, 2, 4, 6, 1, 3, 5, 7);
+		__m256i	First;
+		__m256i	Second;
+
+	First = _mm256_permutevar8x32_epi32(_mm256_loadu_si256(
+		reinterpret_cast<const __m256i*>(Source)), Order);
+	Second = _mm256_permutevar8x32_epi32(_mm256_loadu_si256(
+		reinterpret_cast<const __m256i*>(Source) + 1), Order);
+	DataHigh = _mm256_permute2x128_si256(First, Second, 0x20);
+	DataLow = _mm256_permute2x128_si256(First, Second, 0x31);
+	}
+
+////////////////////////////////////////////////////////////////////////////////
+//! \par	Description:
+//!	Store eight blocks, merging the high and low halves.
+//!
+//! \param	DataHigh	Vector containing the high halves.
+//! \param	DataLow		Vector containing the low halves.
+//! \param	Destination	The array of blocks.
+//!
+//! \throw	None.
+//!
+//! \returns	None.
+//!
+//! \note
+//!	Each half is unpacked as Unpack does, as the processor is little
+//!	endian.
+//!
+//! \see	PARALLEL_BLOCKS
+//! \see	ENCRYPTION_BLOCK_LENGTH
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+AVX2_FUNCTION	LOCAL	inline	void	ParallelStore(__m256i DataHigh,
+					__m256i DataLow, byte Destination
+					[PARALLEL_BLOCKS *
+					ENCRYPTION_BLOCK_LENGTH]) noexcept
+	{
+	__m256i	First;
+	__m256i	Second;
+
+	First = _mm256_unpacklo_epi32(DataHigh, DataLow);
+	Second = _mm256_unpackhi_epi32(DataHigh, DataLow);
+	_mm256_storeu_si256(reinterpret_cast<__m256i*>(Destination),
+		_mm256_permute2x128_si256(First, Second, 0x20));
+	_mm256_storeu_si256(reinterpret_cast<__m256i*>(Destination) + 1,
+		_mm256_permute2x128_si256(First, Second, 0x31));
+	}
+
+////////////////////////////////////////////////////////////////////////////////
+//! \par	Description:
+//!	Compute an AES-128 round key from the previous one.
+//!
+//! \param	Key		The previous round key.
+//! \param	Assist		The result of _mm_aeskeygenassist_si128 applied
+//!				to the previous round key.
+//!
+//! \throw	None.
+//!
+//! \returns	__m128i		The round key.
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+AES_FUNCTION	LOCAL	inline	__m128i	AESExpandKey(__m128i Key, __m128i Assist)
+					noexcept
+	{
+	Assist = _mm_shuffle_epi32(Assist, _MM_SHUFFLE(3, 3, 3, 3));
+	Key = _mm_xor_si128(Key, _mm_slli_si128(Key, 4));
+	Key = _mm_xor_si128(Key, _mm_slli_si128(Key, 4));
+	Key = _mm_xor_si128(Key, _mm_slli_si128(Key, 4));
+	return _mm_xor_si128(Key, Assist);
+	}
+
+////////////////////////////////////////////////////////////////////////////////
+//! \par	Description:
+//!	Compute the AES-128 key schedule.
+//!
+//! \param	Key		The key.
+//! \param	Schedule	Array that upon return will contain the round
+//!				keys.
+//!
+//! \throw	None.
+//!
+//! \returns	None.
+//!
+//! \note
+//!	The round constants must be immediate values, so the loop is unrolled.
+//!
+//! \see	AES_ROUNDS
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+AES_FUNCTION	LOCAL	inline	void	AESSchedule(__m128i Key,
+					__m128i Schedule [AES_ROUNDS + 1])
+					noexcept
+	{
+	Schedule [0] = Key;
+	Schedule [1] = AESExpandKey(Schedule [0],
+		_mm_aeskeygenassist_si128(Schedule [0], 0x01));
+	Schedule [2] = AESExpandKey(Schedule [1],
+		_mm_aeskeygenassist_si128(Schedule [1], 0x02));
+	Schedule [3] = AESExpandKey(Schedule [2],
+		_mm_aeskeygenassist_si128(Schedule [2], 0x04));
+	Schedule [4] = AESExpandKey(Schedule [3],
+		_mm_aeskeygenassist_si128(Schedule [3], 0x08));
+	Schedule [5] = AESExpandKey(Schedule [4],
+		_mm_aeskeygenassist_si128(Schedule [4], 0x10));
+	Schedule [6] = AESExpandKey(Schedule [5],
+		_mm_aeskeygenassist_si128(Schedule [5], 0x20));
+	Schedule [7] = AESExpandKey(Schedule [6],
+		_mm_aeskeygenassist_si128(Schedule [6], 0x40));
+	Schedule [8] = AESExpandKey(Schedule [7],
+		_mm_aeskeygenassist_si128(Schedule [7], 0x80));
+	Schedule [9] = AESExpandKey(Schedule [8],
+		_mm_aeskeygenassist_si128(Schedule [8], 0x1B));
+	Schedule [10] = AESExpandKey(Schedule [9],
+		_mm_aeskeygenassist_si128(Schedule [9], 0x36));
+	}
+
+////////////////////////////////////////////////////////////////////////////////
+//! \par	Description:
+//!	Encrypt a block with AES-128.
+//!
+//! \param	Data		The block.
+//! \param	Schedule	The round keys.
+//!
+//! \throw	None.
+//!
+//! \returns	__m128i		The encrypted block.
+//!
+//! \see	AES_ROUNDS
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+AES_FUNCTION	LOCAL	inline	__m128i	AESEncrypt(__m128i Data,
+					const __m128i Schedule [AES_ROUNDS + 1])
+					noexcept
+	{
+	register	std_uint	Index;
+
+	Data = _mm_xor_si128(Data, Schedule [0]);
+	for (Index = 1; Index < AES_ROUNDS; ++Index)
+		Data = _mm_aesenc_si128(Data, Schedule [Index]);
+	return _mm_aesenclast_si128(Data, Schedule [AES_ROUNDS]);
+	}
+
+////////////////////////////////////////////////////////////////////////////////
+//! \par	Description:
+//!	Compute the function of a Feistel step of the AES engine: the source is
+//!	replicated in all the words of an AES block, that is xor-ed with the
+//!	first key and then passed through two AES rounds.
+//!
+//! \param	Source		The part of source data that is not changed.
+//! \param	Key		The round keys of the step.
+//!
+//! \throw	None.
+//!
+//! \returns	std_uint	The value to xor with the part of source data
+//!				that is changed.
+//!
+//! \see	AES_STEP_KEYS
+//! \see	AES_BLOCK_LENGTH
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+AES_FUNCTION	LOCAL	inline	std_uint	AESFeistelFunction(
+						std_uint Source,
+						const byte Key [AES_STEP_KEYS]
+						[AES_BLOCK_LENGTH]) noexcept
+	{
+	__m128i	Data;
+
+	Data = _mm_xor_si128(_mm_set1_epi32(static_cast<int>(Source)),
+		_mm_loadu_si128(reinterpret_cast<const __m128i*>(Key [0])));
+	Data = _mm_aesenc_si128(Data,
+		_mm_loadu_si128(reinterpret_cast<const __m128i*>(Key [1])));
+	Data = _mm_aesenc_si128(Data,
+		_mm_loadu_si128(reinterpret_cast<const __m128i*>(Key [2])));
+	return static_cast<std_uint>(_mm_cvtsi128_si32(Data));
+	}
+
+# endif
+
 ////////////////////////////////////////////////////////////////////////////////
 //! \par	Description:
 //!	Implement a S-box, that is, substitute a byte with another.
@@ -526,7 +826,7 @@ byte	Cryptography::SBox_7(byte Value) noexcept
 
 ////////////////////////////////////////////////////////////////////////////////
 //! \par	Description:
-//!	Crypt a block of data. \n
+//!	Crypt a block of data with the S-box Feistel engine. \n
 //!	The block is crypted executing 8 steps of Feistel functions, each
 //!	operating on half of the data block, exchanging the role of the two
 //!	halves at each steps. \n
@@ -547,31 +847,29 @@ byte	Cryptography::SBox_7(byte Value) noexcept
 //!
 ////////////////////////////////////////////////////////////////////////////////
 
-void	Cryptography::Crypt(const byte Plain [ENCRYPTION_BLOCK_LENGTH],
+void	Cryptography::FeistelCrypt(const byte Plain [ENCRYPTION_BLOCK_LENGTH],
 		byte Encrypted [ENCRYPTION_BLOCK_LENGTH]) const noexcept
 	{
 	std_uint	DataHigh;
 	std_uint	DataLow;
 
-memcpy(Encrypted, Plain, ENCRYPTION_KEY_LENGTH);
-return;
 	DataHigh = Pack(Plain);
 	DataLow = Pack(Plain + sizeof(std_uint));
-	FeistelStep(DataLow, DataHigh, RotatedKey [0], SubsFunctionTable [0]);
-	FeistelStep(DataHigh, DataLow, RotatedKey [1], SubsFunctionTable [1]);
-	FeistelStep(DataHigh, DataLow, RotatedKey [2], SubsFunctionTable [2]);
-	FeistelStep(DataHigh, DataLow, RotatedKey [3], SubsFunctionTable [3]);
-	FeistelStep(DataLow, DataHigh, RotatedKey [4], SubsFunctionTable [4]);
-	FeistelStep(DataHigh, DataLow, RotatedKey [5], SubsFunctionTable [5]);
-	FeistelStep(DataLow, DataHigh, RotatedKey [6], SubsFunctionTable [6]);
-	FeistelStep(DataHigh, DataLow, RotatedKey [7], SubsFunctionTable [7]);
+	FeistelStep<0>(DataLow, DataHigh);
+	FeistelStep<1>(DataHigh, DataLow);
+	FeistelStep<2>(DataLow, DataHigh);
+	FeistelStep<3>(DataHigh, DataLow);
+	FeistelStep<4>(DataLow, DataHigh);
+	FeistelStep<5>(DataHigh, DataLow);
+	FeistelStep<6>(DataLow, DataHigh);
+	FeistelStep<7>(DataHigh, DataLow);
 	Unpack(DataHigh, Encrypted);
 	Unpack(DataLow, Encrypted + sizeof(std_uint));
 	}
 
 ////////////////////////////////////////////////////////////////////////////////
 //! \par	Description:
-//!	Decrypt a block of data. \n
+//!	Decrypt a block of data with the S-box Feistel engine. \n
 //!	The block is decrypted executing 8 steps of Feistel functions, each
 //!	operating on half of the data block, exchanging the role of the two
 //!	halves at each steps. \n
@@ -592,26 +890,750 @@ return;
 //!
 ////////////////////////////////////////////////////////////////////////////////
 
-void	Cryptography::Decrypt(const byte Encrypted [ENCRYPTION_BLOCK_LENGTH],
-		byte Plain [ENCRYPTION_BLOCK_LENGTH]) const noexcept
+void	Cryptography::FeistelDecrypt(const byte Encrypted
+		[ENCRYPTION_BLOCK_LENGTH], byte Plain [ENCRYPTION_BLOCK_LENGTH])
+		const noexcept
 	{
 	std_uint	DataHigh;
 	std_uint	DataLow;
 
-memcpy(Plain, Encrypted, ENCRYPTION_KEY_LENGTH);
-return;
 	DataHigh = Pack(Encrypted);
 	DataLow = Pack(Encrypted + sizeof(std_uint));
-	FeistelStep(DataHigh, DataLow, RotatedKey [7], SubsFunctionTable [7]);
-	FeistelStep(DataLow, DataHigh, RotatedKey [6], SubsFunctionTable [6]);
-	FeistelStep(DataHigh, DataLow, RotatedKey [5], SubsFunctionTable [5]);
-	FeistelStep(DataLow, DataHigh, RotatedKey [4], SubsFunctionTable [4]);
-	FeistelStep(DataHigh, DataLow, RotatedKey [3], SubsFunctionTable [3]);
-	FeistelStep(DataLow, DataHigh, RotatedKey [2], SubsFunctionTable [2]);
-	FeistelStep(DataHigh, DataLow, RotatedKey [1], SubsFunctionTable [1]);
-	FeistelStep(DataLow, DataHigh, RotatedKey [0], SubsFunctionTable [0]);
+	FeistelStep<7>(DataHigh, DataLow);
+	FeistelStep<6>(DataLow, DataHigh);
+	FeistelStep<5>(DataHigh, DataLow);
+	FeistelStep<4>(DataLow, DataHigh);
+	FeistelStep<3>(DataHigh, DataLow);
+	FeistelStep<2>(DataLow, DataHigh);
+	FeistelStep<1>(DataHigh, DataLow);
+	FeistelStep<0>(DataLow, DataHigh);
 	Unpack(DataHigh, Plain);
 	Unpack(DataLow, Plain + sizeof(std_uint));
 	}
 
+////////////////////////////////////////////////////////////////////////////////
+//! \par	Description:
+//!	Crypt a block of data with the AES engine. \n
+//!	The block is crypted executing AES_FEISTEL_STEPS steps of Feistel
+//!	functions, each operating on half of the data block, exchanging the
+//!	role of the two halves at each steps; the function of each step is
+//!	computed with AES rounds, using the round keys of the step.
+//!
+//! \param	Plain		The array of data to be crypted.
+//! \param	Encrypted	The array of encrypted data.
+//!
+//! \throw	None.
+//!
+//! \returns	None.
+//!
+//! \note
+//!	Plain and Encrypted buffers can overlap. \n
+//!	It must be called only if IsAESSupported returns true.
+//!
+//! \see	AES_FEISTEL_STEPS
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+# if COMPILER == GNU_4
+AES_FUNCTION
+# endif
+void	Cryptography::AESCrypt(const byte Plain [ENCRYPTION_BLOCK_LENGTH],
+		byte Encrypted [ENCRYPTION_BLOCK_LENGTH]) const noexcept
+	{
+# if COMPILER == GNU_4
+	register	std_uint	Step;
+			std_uint	DataHigh;
+			std_uint	DataLow;
+
+	DataHigh = Pack(Plain);
+	DataLow = Pack(Plain + sizeof(std_uint));
+	for (Step = 0; Step < AES_FEISTEL_STEPS; Step += 2)
+		{
+		DataHigh ^= AESFeistelFunction(DataLow, AESKey [Step]);
+		DataLow ^= AESFeistelFunction(DataHigh, AESKey [Step + 1]);
+		}
+	Unpack(DataHigh, Encrypted);
+	Unpack(DataLow, Encrypted + sizeof(std_uint));
+# else
+	ignore_value(Plain);
+	ignore_value(Encrypted);
+	assert(false);
+# endif
+	}
+
+////////////////////////////////////////////////////////////////////////////////
+//! \par	Description:
+//!	Decrypt a block of data with the AES engine. \n
+//!	The steps of AESCrypt are executed in reverse order.
+//!
+//! \param	Encrypted	The array of encrypted data.
+//! \param	Plain		The array of decrypted data.
+//!
+//! \throw	None.
+//!
+//! \returns	None.
+//!
+//! \note
+//!	Plain and Encrypted buffers can overlap. \n
+//!	It must be called only if IsAESSupported returns true.
+//!
+//! \see	AES_FEISTEL_STEPS
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+# if COMPILER == GNU_4
+AES_FUNCTION
+# endif
+void	Cryptography::AESDecrypt(const byte Encrypted [ENCRYPTION_BLOCK_LENGTH],
+		byte Plain [ENCRYPTION_BLOCK_LENGTH]) const noexcept
+	{
+# if COMPILER == GNU_4
+	register	std_uint	Step;
+			std_uint	DataHigh;
+			std_uint	DataLow;
+
+	DataHigh = Pack(Encrypted);
+	DataLow = Pack(Encrypted + sizeof(std_uint));
+	for (Step = AES_FEISTEL_STEPS; Step > 0; Step -= 2)
+		{
+		DataLow ^= AESFeistelFunction(DataHigh, AESKey [Step - 1]);
+		DataHigh ^= AESFeistelFunction(DataLow, AESKey [Step - 2]);
+		}
+	Unpack(DataHigh, Plain);
+	Unpack(DataLow, Plain + sizeof(std_uint));
+# else
+	ignore_value(Encrypted);
+	ignore_value(Plain);
+	assert(false);
+# endif
+	}
+
+////////////////////////////////////////////////////////////////////////////////
+//! \par	Description:
+//!	Compute the round keys of the AES engine. \n
+//!	Each round key is computed encrypting with AES-128 and the given key a
+//!	counter, made of the index of the Feistel step and the index of the
+//!	round key.
+//!
+//! \param	thisKey	The encryption key.
+//!
+//! \throw	None.
+//!
+//! \returns	None.
+//!
+//! \note
+//!	It must be called only if IsAESSupported returns true.
+//!
+//! \see	AES_FEISTEL_STEPS
+//! \see	AES_STEP_KEYS
+//! \see	AES_ROUNDS
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+# if COMPILER == GNU_4
+AES_FUNCTION
+# endif
+void	Cryptography::MakeAESKey(const byte thisKey [ENCRYPTION_KEY_LENGTH])
+		noexcept
+	{
+# if COMPILER == GNU_4
+	register	std_uint	Step;
+	register	std_uint	Index;
+			__m128i		Schedule [AES_ROUNDS + 1];
+
+	AESSchedule(_mm_loadu_si128(reinterpret_cast<const __m128i*>(thisKey)),
+		Schedule);
+	for (Step = 0; Step < AES_FEISTEL_STEPS; ++Step)
+		for (Index = 0; Index < AES_STEP_KEYS; ++Index)
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(
+				AESKey [Step] [Index]),
+				AESEncrypt(_mm_set_epi32(0, 0,
+				static_cast<int>(Step), static_cast<int>(Index)),
+				Schedule));
+# else
+	ignore_value(thisKey);
+	assert(false);
+# endif
+	}
+
+////////////////////////////////////////////////////////////////////////////////
+//! \par	Description:
+//!	Check whether the AES engine can be used, that is, whether the
+//!	processor supports AES-NI instructions.
+//!
+//! \throw	None.
+//!
+//! \returns	true	If the AES engine can be used.
+//! \returns	false	Otherwise.
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+bool	Cryptography::IsAESSupported(void) noexcept
+	{
+# if COMPILER == GNU_4
+	static	const	bool	Supported = __builtin_cpu_supports("aes") and
+					__builtin_cpu_supports("sse4.1");
+
+	return Supported;
+# else
+	return false;
+# endif
+	}
+
+////////////////////////////////////////////////////////////////////////////////
+//! \par	Description:
+//!	Check whether a cipher engine is valid and supported by the processor.
+//!
+//! \param	thisEngine	Identifier of the engine.
+//!
+//! \throw	None.
+//!
+//! \returns	true	If the engine can be used.
+//! \returns	false	Otherwise.
+//!
+//! \see	FEISTEL_ENGINE
+//! \see	AES_ENGINE
+//! \see	PLAIN_ENGINE
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+bool	Cryptography::IsEngineSupported(std_uint thisEngine) noexcept
+	{
+	switch (thisEngine)
+		{
+		case FEISTEL_ENGINE:
+			return true;
+
+		case AES_ENGINE:
+			return IsAESSupported();
+
+		case PLAIN_ENGINE:
+			return true;
+
+		default:
+			return false;
+		}
+	}
+
+////////////////////////////////////////////////////////////////////////////////
+//! \par	Description:
+//!	Get the cipher engine to be used for new elections, that is, the AES
+//!	engine if the processor supports it, the S-box Feistel engine
+//!	otherwise.
+//!
+//! \throw	None.
+//!
+//! \returns	std_uint	Identifier of the engine.
+//!
+//! \see	FEISTEL_ENGINE
+//! \see	AES_ENGINE
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+std_uint	Cryptography::GetPreferredEngine(void) noexcept
+	{
+	return IsAESSupported() ? AES_ENGINE: FEISTEL_ENGINE;
+	}
+
+////////////////////////////////////////////////////////////////////////////////
+//! \par	Description:
+//!	Crypt a block of data, using the selected cipher engine.
+//!
+//! \param	Plain		The array of data to be crypted.
+//! \param	Encrypted	The array of encrypted data.
+//!
+//! \throw	None.
+//!
+//! \returns	None.
+//!
+//! \note
+//!	Plain and Encrypted buffers can overlap.
+//!
+//! \see	ENCRYPTION_BLOCK_LENGTH
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+void	Cryptography::Crypt(const byte Plain [ENCRYPTION_BLOCK_LENGTH],
+		byte Encrypted [ENCRYPTION_BLOCK_LENGTH]) const noexcept
+	{
+	if (Engine == AES_ENGINE)
+		AESCrypt(Plain, Encrypted);
+	else if (Engine == PLAIN_ENGINE)
+		ignore_value(memmove(Encrypted, Plain, ENCRYPTION_BLOCK_LENGTH));
+	else
+		FeistelCrypt(Plain, Encrypted);
+	}
+
+////////////////////////////////////////////////////////////////////////////////
+//! \par	Description:
+//!	Decrypt a block of data, using the selected cipher engine.
+//!
+//! \param	Encrypted	The array of encrypted data.
+//! \param	Plain		The array of decrypted data.
+//!
+//! \throw	None.
+//!
+//! \returns	None.
+//!
+//! \note
+//!	Plain and Encrypted buffers can overlap.
+//!
+//! \see	ENCRYPTION_BLOCK_LENGTH
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+void	Cryptography::Decrypt(const byte Encrypted [ENCRYPTION_BLOCK_LENGTH],
+		byte Plain [ENCRYPTION_BLOCK_LENGTH]) const noexcept
+	{
+	if (Engine == AES_ENGINE)
+		AESDecrypt(Encrypted, Plain);
+	else if (Engine == PLAIN_ENGINE)
+		ignore_value(memmove(Plain, Encrypted, ENCRYPTION_BLOCK_LENGTH));
+	else
+		FeistelDecrypt(Encrypted, Plain);
+	}
+
+////////////////////////////////////////////////////////////////////////////////
+//! \par	Description:
+//!	Fill the table of the S-box functions used in each Feistel step,
+//!	composed with bit diffusion.
+//!
+//! \throw	None.
+//!
+//! \returns	true.
+//!
+//! \see	BYTE_FEISTEL_STEPS
+//! \see	BYTE_MAX
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+bool	Cryptography::FillFusedTable(void) noexcept
+	{
+	register	std_uint	Step;
+	register	std_uint	Index;
+	register	std_uint	Value;
+
+	for (Step = 0; Step < BYTE_FEISTEL_STEPS; ++Step)
+		for (Index = 0; Index < sizeof(std_uint); ++Index)
+			for (Value = 0; Value <= BYTE_MAX; ++Value)
+				FusedTable [Step] [Index] [Value] =
+					DiffuseTable [Index]
+					[SubsFunctionTable [Step] [Index]
+					(static_cast<byte>(Value))];
+	return true;
+	}
+
+////////////////////////////////////////////////////////////////////////////////
+//! \par	Description:
+//!	Fill the FusedTable, if it is not filled yet.
+//!
+//! \throw	None.
+//!
+//! \returns	None.
+//!
+//! \note
+//!	The initialization of a local static variable is executed only once,
+//!	even if more threads call the function at the same time.
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+void	Cryptography::MakeFusedTable(void) noexcept
+	{
+	static	const	bool	Filled = FillFusedTable();
+
+	assert(Filled);
+	}
+
+////////////////////////////////////////////////////////////////////////////////
+//! \par	Description:
+//!	Check whether the vector implementation of the Feistel functions can be
+//!	used, that is, whether the processor supports AVX2 instructions.
+//!
+//! \throw	None.
+//!
+//! \returns	true	If the vector implementation can be used.
+//! \returns	false	Otherwise.
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+bool	Cryptography::IsParallelSupported(void) noexcept
+	{
+# if COMPILER == GNU_4
+	static	const	bool	Supported = __builtin_cpu_supports("avx2");
+
+	return Supported;
+# else
+	return false;
+# endif
+	}
+
+////////////////////////////////////////////////////////////////////////////////
+//! \par	Description:
+//!	Crypt PARALLEL_BLOCKS blocks of data together, using AVX2 instructions.
+//!	\n
+//!	The result is the same as calling Crypt for each block.
+//!
+//! \param	Plain		The array of data to be crypted.
+//! \param	Encrypted	The array of encrypted data.
+//!
+//! \throw	None.
+//!
+//! \returns	None.
+//!
+//! \note
+//!	Plain and Encrypted buffers can be the same buffer. \n
+//!	It must be called only if IsParallelSupported returns true.
+//!
+//! \see	PARALLEL_BLOCKS
+//! \see	ENCRYPTION_BLOCK_LENGTH
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+# if COMPILER == GNU_4
+AVX2_FUNCTION
+# endif
+void	Cryptography::CryptParallel(const byte Plain [PARALLEL_BLOCKS *
+		ENCRYPTION_BLOCK_LENGTH], byte Encrypted [PARALLEL_BLOCKS *
+		ENCRYPTION_BLOCK_LENGTH]) const noexcept
+	{
+# if COMPILER == GNU_4
+	__m256i	DataHigh;
+	__m256i	DataLow;
+
+	ParallelLoad(Plain, DataHigh, DataLow);
+	ParallelFeistelStep(DataLow, DataHigh, RotatedKey [0],
+		FusedTable [0]);
+	ParallelFeistelStep(DataHigh, DataLow, RotatedKey [1],
+		FusedTable [1]);
+	ParallelFeistelStep(DataLow, DataHigh, RotatedKey [2],
+		FusedTable [2]);
+	ParallelFeistelStep(DataHigh, DataLow, RotatedKey [3],
+		FusedTable [3]);
+	ParallelFeistelStep(DataLow, DataHigh, RotatedKey [4],
+		FusedTable [4]);
+	ParallelFeistelStep(DataHigh, DataLow, RotatedKey [5],
+		FusedTable [5]);
+	ParallelFeistelStep(DataLow, DataHigh, RotatedKey [6],
+		FusedTable [6]);
+	ParallelFeistelStep(DataHigh, DataLow, RotatedKey [7],
+		FusedTable [7]);
+	ParallelStore(DataHigh, DataLow, Encrypted);
+# else
+	register	std_uint	Index;
+
+	for (Index = 0; Index < PARALLEL_BLOCKS; ++Index)
+		Crypt(Plain + Index * ENCRYPTION_BLOCK_LENGTH,
+			Encrypted + Index * ENCRYPTION_BLOCK_LENGTH);
+# endif
+	}
+
+////////////////////////////////////////////////////////////////////////////////
+//! \par	Description:
+//!	Decrypt PARALLEL_BLOCKS blocks of data together, using AVX2
+//!	instructions. \n
+//!	The result is the same as calling Decrypt for each block.
+//!
+//! \param	Encrypted	The array of encrypted data.
+//! \param	Plain		The array of decrypted data.
+//!
+//! \throw	None.
+//!
+//! \returns	None.
+//!
+//! \note
+//!	Plain and Encrypted buffers can be the same buffer. \n
+//!	It must be called only if IsParallelSupported returns true.
+//!
+//! \see	PARALLEL_BLOCKS
+//! \see	ENCRYPTION_BLOCK_LENGTH
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+# if COMPILER == GNU_4
+AVX2_FUNCTION
+# endif
+void	Cryptography::DecryptParallel(const byte Encrypted [PARALLEL_BLOCKS *
+		ENCRYPTION_BLOCK_LENGTH], byte Plain [PARALLEL_BLOCKS *
+		ENCRYPTION_BLOCK_LENGTH]) const noexcept
+	{
+# if COMPILER == GNU_4
+	__m256i	DataHigh;
+	__m256i	DataLow;
+
+	ParallelLoad(Encrypted, DataHigh, DataLow);
+	ParallelFeistelStep(DataHigh, DataLow, RotatedKey [7],
+		FusedTable [7]);
+	ParallelFeistelStep(DataLow, DataHigh, RotatedKey [6],
+		FusedTable [6]);
+	ParallelFeistelStep(DataHigh, DataLow, RotatedKey [5],
+		FusedTable [5]);
+	ParallelFeistelStep(DataLow, DataHigh, RotatedKey [4],
+		FusedTable [4]);
+	ParallelFeistelStep(DataHigh, DataLow, RotatedKey [3],
+		FusedTable [3]);
+	ParallelFeistelStep(DataLow, DataHigh, RotatedKey [2],
+		FusedTable [2]);
+	ParallelFeistelStep(DataHigh, DataLow, RotatedKey [1],
+		FusedTable [1]);
+	ParallelFeistelStep(DataLow, DataHigh, RotatedKey [0],
+		FusedTable [0]);
+	ParallelStore(DataHigh, DataLow, Plain);
+# else
+	register	std_uint	Index;
+
+	for (Index = 0; Index < PARALLEL_BLOCKS; ++Index)
+		Decrypt(Encrypted + Index * ENCRYPTION_BLOCK_LENGTH,
+			Plain + Index * ENCRYPTION_BLOCK_LENGTH);
+# endif
+	}
+
+////////////////////////////////////////////////////////////////////////////////
+//! \par	Description:
+//!	Crypt PARALLEL_BLOCKS blocks of data together with the AES engine,
+//!	interleaving the AES rounds of different blocks. \n
+//!	The result is the same as calling AESCrypt for each block.
+//!
+//! \param	Plain		The array of data to be crypted.
+//! \param	Encrypted	The array of encrypted data.
+//!
+//! \throw	None.
+//!
+//! \returns	None.
+//!
+//! \note
+//!	Plain and Encrypted buffers can be the same buffer. \n
+//!	It must be called only if IsAESSupported returns true.
+//!
+//! \see	PARALLEL_BLOCKS
+//! \see	AES_FEISTEL_STEPS
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+# if COMPILER == GNU_4
+AES_FUNCTION
+# endif
+void	Cryptography::AESCryptParallel(const byte Plain [PARALLEL_BLOCKS *
+		ENCRYPTION_BLOCK_LENGTH], byte Encrypted [PARALLEL_BLOCKS *
+		ENCRYPTION_BLOCK_LENGTH]) const noexcept
+	{
+# if COMPILER == GNU_4
+	register	std_uint	Step;
+	register	std_uint	Index;
+			std_uint	DataHigh [PARALLEL_BLOCKS];
+			std_uint	DataLow [PARALLEL_BLOCKS];
+
+	for (Index = 0; Index < PARALLEL_BLOCKS; ++Index)
+		{
+		DataHigh [Index] = Pack(Plain + Index * ENCRYPTION_BLOCK_LENGTH);
+		DataLow [Index] = Pack(Plain + Index * ENCRYPTION_BLOCK_LENGTH +
+			sizeof(std_uint));
+		}
+	for (Step = 0; Step < AES_FEISTEL_STEPS; Step += 2)
+		{
+		for (Index = 0; Index < PARALLEL_BLOCKS; ++Index)
+			DataHigh [Index] ^= AESFeistelFunction(DataLow [Index],
+				AESKey [Step]);
+		for (Index = 0; Index < PARALLEL_BLOCKS; ++Index)
+			DataLow [Index] ^= AESFeistelFunction(DataHigh [Index],
+				AESKey [Step + 1]);
+		}
+	for (Index = 0; Index < PARALLEL_BLOCKS; ++Index)
+		{
+		Unpack(DataHigh [Index], Encrypted +
+			Index * ENCRYPTION_BLOCK_LENGTH);
+		Unpack(DataLow [Index], Encrypted +
+			Index * ENCRYPTION_BLOCK_LENGTH + sizeof(std_uint));
+		}
+# else
+	register	std_uint	Index;
+
+	for (Index = 0; Index < PARALLEL_BLOCKS; ++Index)
+		AESCrypt(Plain + Index * ENCRYPTION_BLOCK_LENGTH,
+			Encrypted + Index * ENCRYPTION_BLOCK_LENGTH);
+# endif
+	}
+
+////////////////////////////////////////////////////////////////////////////////
+//! \par	Description:
+//!	Decrypt PARALLEL_BLOCKS blocks of data together with the AES engine,
+//!	interleaving the AES rounds of different blocks. \n
+//!	The result is the same as calling AESDecrypt for each block.
+//!
+//! \param	Encrypted	The array of encrypted data.
+//! \param	Plain		The array of decrypted data.
+//!
+//! \throw	None.
+//!
+//! \returns	None.
+//!
+//! \note
+//!	Plain and Encrypted buffers can be the same buffer. \n
+//!	It must be called only if IsAESSupported returns true.
+//!
+//! \see	PARALLEL_BLOCKS
+//! \see	AES_FEISTEL_STEPS
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+# if COMPILER == GNU_4
+AES_FUNCTION
+# endif
+void	Cryptography::AESDecryptParallel(const byte Encrypted [PARALLEL_BLOCKS *
+		ENCRYPTION_BLOCK_LENGTH], byte Plain [PARALLEL_BLOCKS *
+		ENCRYPTION_BLOCK_LENGTH]) const noexcept
+	{
+# if COMPILER == GNU_4
+	register	std_uint	Step;
+	register	std_uint	Index;
+			std_uint	DataHigh [PARALLEL_BLOCKS];
+			std_uint	DataLow [PARALLEL_BLOCKS];
+
+	for (Index = 0; Index < PARALLEL_BLOCKS; ++Index)
+		{
+		DataHigh [Index] = Pack(Encrypted +
+			Index * ENCRYPTION_BLOCK_LENGTH);
+		DataLow [Index] = Pack(Encrypted +
+			Index * ENCRYPTION_BLOCK_LENGTH + sizeof(std_uint));
+		}
+	for (Step = AES_FEISTEL_STEPS; Step > 0; Step -= 2)
+		{
+		for (Index = 0; Index < PARALLEL_BLOCKS; ++Index)
+			DataLow [Index] ^= AESFeistelFunction(DataHigh [Index],
+				AESKey [Step - 1]);
+		for (Index = 0; Index < PARALLEL_BLOCKS; ++Index)
+			DataHigh [Index] ^= AESFeistelFunction(DataLow [Index],
+				AESKey [Step - 2]);
+		}
+	for (Index = 0; Index < PARALLEL_BLOCKS; ++Index)
+		{
+		Unpack(DataHigh [Index], Plain + Index * ENCRYPTION_BLOCK_LENGTH);
+		Unpack(DataLow [Index], Plain + Index * ENCRYPTION_BLOCK_LENGTH +
+			sizeof(std_uint));
+		}
+# else
+	register	std_uint	Index;
+
+	for (Index = 0; Index < PARALLEL_BLOCKS; ++Index)
+		AESDecrypt(Encrypted + Index * ENCRYPTION_BLOCK_LENGTH,
+			Plain + Index * ENCRYPTION_BLOCK_LENGTH);
+# endif
+	}
+
+////////////////////////////////////////////////////////////////////////////////
+//! \par	Description:
+//!	Crypt a sequence of blocks of data. \n
+//!	With the AES engine, or with the S-box Feistel engine if the
+//!	processor supports AVX2 instructions, groups of PARALLEL_BLOCKS blocks
+//!	are crypted together; remaining blocks are
+//!	crypted one at a time. \n
+//!	The result is the same as calling Crypt for each block.
+//!
+//! \param	Plain		The array of data to be crypted.
+//! \param	Encrypted	The array of encrypted data.
+//! \param	Blocks		The number of blocks.
+//!
+//! \throw	None.
+//!
+//! \returns	None.
+//!
+//! \note
+//!	Plain and Encrypted buffers can be the same buffer, but they cannot
+//!	overlap otherwise.
+//!
+//! \see	PARALLEL_BLOCKS
+//! \see	ENCRYPTION_BLOCK_LENGTH
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+void	Cryptography::CryptBlocks(register const byte* Plain,
+		register byte* Encrypted, register std_uint Blocks) const
+		noexcept
+	{
+	if (Engine == PLAIN_ENGINE)
+		{
+		if (Encrypted != Plain)
+			ignore_value(memcpy(Encrypted, Plain, Blocks *
+				ENCRYPTION_BLOCK_LENGTH));
+		return;
+		}
+	if (Engine == AES_ENGINE)
+		for (; Blocks >= PARALLEL_BLOCKS; Blocks -= PARALLEL_BLOCKS)
+			{
+			AESCryptParallel(Plain, Encrypted);
+			Plain += PARALLEL_BLOCKS * ENCRYPTION_BLOCK_LENGTH;
+			Encrypted += PARALLEL_BLOCKS * ENCRYPTION_BLOCK_LENGTH;
+			}
+	else if (IsParallelSupported())
+		for (; Blocks >= PARALLEL_BLOCKS; Blocks -= PARALLEL_BLOCKS)
+			{
+			CryptParallel(Plain, Encrypted);
+			Plain += PARALLEL_BLOCKS * ENCRYPTION_BLOCK_LENGTH;
+			Encrypted += PARALLEL_BLOCKS * ENCRYPTION_BLOCK_LENGTH;
+			}
+	for (; Blocks > 0; --Blocks)
+		{
+		Crypt(Plain, Encrypted);
+		Plain += ENCRYPTION_BLOCK_LENGTH;
+		Encrypted += ENCRYPTION_BLOCK_LENGTH;
+		}
+	}
+
+////////////////////////////////////////////////////////////////////////////////
+//! \par	Description:
+//!	Decrypt a sequence of blocks of data. \n
+//!	With the AES engine, or with the S-box Feistel engine if the
+//!	processor supports AVX2 instructions, groups of PARALLEL_BLOCKS blocks
+//!	are decrypted together; remaining blocks are
+//!	decrypted one at a time. \n
+//!	The result is the same as calling Decrypt for each block.
+//!
+//! \param	Encrypted	The array of encrypted data.
+//! \param	Plain		The array of decrypted data.
+//! \param	Blocks		The number of blocks.
+//!
+//! \throw	None.
+//!
+//! \returns	None.
+//!
+//! \note
+//!	Plain and Encrypted buffers can be the same buffer, but they cannot
+//!	overlap otherwise.
+//!
+//! \see	PARALLEL_BLOCKS
+//! \see	ENCRYPTION_BLOCK_LENGTH
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+void	Cryptography::DecryptBlocks(register const byte* Encrypted,
+		register byte* Plain, register std_uint Blocks) const noexcept
+	{
+	if (Engine == PLAIN_ENGINE)
+		{
+		if (Plain != Encrypted)
+			ignore_value(memcpy(Plain, Encrypted, Blocks *
+				ENCRYPTION_BLOCK_LENGTH));
+		return;
+		}
+	if (Engine == AES_ENGINE)
+		for (; Blocks >= PARALLEL_BLOCKS; Blocks -= PARALLEL_BLOCKS)
+			{
+			AESDecryptParallel(Encrypted, Plain);
+			Encrypted += PARALLEL_BLOCKS * ENCRYPTION_BLOCK_LENGTH;
+			Plain += PARALLEL_BLOCKS * ENCRYPTION_BLOCK_LENGTH;
+			}
+	else if (IsParallelSupported())
+		for (; Blocks >= PARALLEL_BLOCKS; Blocks -= PARALLEL_BLOCKS)
+			{
+			DecryptParallel(Encrypted, Plain);
+			Encrypted += PARALLEL_BLOCKS * ENCRYPTION_BLOCK_LENGTH;
+			Plain += PARALLEL_BLOCKS * ENCRYPTION_BLOCK_LENGTH;
+			}
+	for (; Blocks > 0; --Blocks)
+		{
+		Decrypt(Encrypted, Plain);
+		Encrypted += ENCRYPTION_BLOCK_LENGTH;
+		Plain += ENCRYPTION_BLOCK_LENGTH;
+		}
+	}
+
 }
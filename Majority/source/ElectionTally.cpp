@@ -0,0 +1,227 @@
+////////////////////////////////////////////////////////////////////////////////
+//! \file
+//!
+//! \author	agent
+//!
+//! \date	16/10/2026
+//!
+//!	It contains the definitions of static attributes and non inline
+//!	functions of the utility_space::ElectionTally class.
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+# include	"Standard.h"
+# include	"ElectionTally.h"
+
+# if !defined	USE_INLINE
+# include	"ElectionTally.inl"
+# endif
+
+namespace	utility_space
+{
+
+using	namespace	data_structure_space;
+
+const	ElectionTally::CountFunctionType	ElectionTally::CountFunctions
+	[MAXIMUM_VOTE] =
+	{
+	&ElectionTally::CountEncoded<1>,
+	&ElectionTally::CountEncoded<2>,
+	&ElectionTally::CountEncoded<3>,
+	&ElectionTally::CountEncoded<4>,
+	&ElectionTally::CountEncoded<5>,
+	&ElectionTally::CountEncoded<6>,
+	&ElectionTally::CountEncoded<7>,
+	&ElectionTally::CountEncoded<8>,
+	&ElectionTally::CountEncoded<9>,
+	&ElectionTally::CountEncoded<10>,
+	&ElectionTally::CountEncoded<11>,
+	&ElectionTally::CountEncoded<12>,
+	&ElectionTally::CountEncoded<13>,
+	&ElectionTally::CountEncoded<14>,
+	&ElectionTally::CountEncoded<15>
+	};
+
+static_assert(MAXIMUM_VOTE == 15,
+	"Wrong MAXIMUM_VOTE, not equal to the number of count functions");
+
+////////////////////////////////////////////////////////////////////////////////
+//! \par	Description:
+//!	Sort an array of indices of candidates in increasing order of votes. \n
+//!	The algorithm used is heapsort with a binary heap, performed in place
+//!	on the indices, comparing the counters directly in the array.
+//!
+//! \param	Index	Pointer to the first index to sort.
+//! \param	Size	Number of indices to sort.
+//!
+//! \throw	None.
+//!
+//! \returns	None.
+//!
+//! \note
+//!	Candidates with equal votes are in decreasing order of index.
+//!
+//! \see	Precedes
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+void	ElectionTally::SortRange(register std_uint* Index, std_uint Size) const
+		noexcept
+	{
+	register	std_uint	Parent;
+	register	std_uint	Child;
+	register	std_uint	Value;
+	register	std_uint	Position;
+
+	if (Size < 2)
+		return;
+	for (Position = Size / 2 + Size; Position > 0;)
+		{
+		if (Position > Size)
+			Value = Index [Parent = --Position - Size];
+		else
+			{
+			Value = Index [--Position];
+			Index [Position] = Index [0];
+			Size = Position;
+			Parent = 0;
+			}
+		for (; (Child = 2 * Parent + 1) < Size; Parent = Child)
+			{
+			if (Child + 1 < Size and Precedes(Index [Child],
+				Index [Child + 1]))
+				++Child;
+			if (not Precedes(Value, Index [Child]))
+				break;
+			Index [Parent] = Index [Child];
+			}
+		Index [Parent] = Value;
+		}
+	}
+
+////////////////////////////////////////////////////////////////////////////////
+//! \par	Description:
+//!	Create a Vector containing the indices of the candidates, sorted in
+//!	increasing order of votes. \n
+//!	The indices, initially in decreasing order, are sorted by a stable
+//!	least significant digit radix sort, a byte at a time, on the sort keys
+//!	of the candidates, skipping the bytes equal in all the keys; if the
+//!	keys cannot contain all the counters, the candidates with equal keys
+//!	are then sorted comparing all their counters.
+//!
+//! \param	OrderedIndex			Reference to the Vector that
+//!						upon return contains the indices
+//!						of the candidates.
+//!
+//! \throw	utility_space::OUT_OF_MEMORY	If memory allocation fails.
+//!
+//! \returns	None.
+//!
+//! \note
+//!	The lower extremes must have been computed, otherwise the order is
+//!	unpredictable; candidates with equal votes are in decreasing order of
+//!	index.
+//!
+//! \see	GetSortKey
+//! \see	SortRange
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+void	ElectionTally::SortCandidates(register Vector<std_uint>& OrderedIndex)
+		const throw(FatalException)
+	{
+	register	std_uint*	Index;
+	register	std_uint*	OtherIndex;
+	register	std_uint*	SwapIndex;
+	register	std_ulong*	Key;
+	register	std_ulong*	OtherKey;
+	register	std_ulong*	SwapKey;
+	register	std_uint	MaximumCounter;
+	register	std_uint	CounterBits;
+	register	std_uint	KeyBits;
+	register	std_uint	Fields;
+	register	std_uint	Shift;
+	register	std_uint	Position;
+	register	std_uint	First;
+	register	std_uint	Digit;
+	register	std_uint	Sum;
+			std_uint	Buckets [BYTE_MAX + 1];
+
+	OrderedIndex.Clear();
+	if (Candidates == 0)
+		return;
+	OrderedIndex.Append(0, Candidates);
+	if (Candidates < 2)
+		return;
+	MaximumCounter = 0;
+	for (Position = 0; Position < Counters.GetPresent(); ++Position)
+		if (Counters [Position] > MaximumCounter)
+			MaximumCounter = Counters [Position];
+	for (CounterBits = 0; CounterBits < STD_UINT_BITS and
+		(MaximumCounter >> CounterBits) != 0; ++CounterBits)
+		;
+	for (KeyBits = 0; (Values >> KeyBits) != 0; ++KeyBits)
+		;
+	if (CounterBits == 0)
+		Fields = Values;
+	else if ((Fields = (STD_ULONG_BITS - KeyBits) / CounterBits) > Values)
+		Fields = Values;
+	KeyBits += Fields * CounterBits;
+
+	Vector<std_uint>	IndexBuffer(Candidates);
+	Vector<std_ulong>	Keys(2 * Candidates);
+
+	IndexBuffer.Append(0, Candidates);
+	Keys.Append(0, 2 * Candidates);
+	Index = &OrderedIndex [0];
+	OtherIndex = &IndexBuffer [0];
+	Key = &Keys [0];
+	OtherKey = Key + Candidates;
+	for (Position = 0; Position < Candidates; ++Position)
+		{
+		Index [Position] = Candidates - 1 - Position;
+		Key [Position] = GetSortKey(Index [Position], CounterBits,
+			Fields, MaximumCounter);
+		}
+	for (Shift = 0; Shift < KeyBits; Shift += CHAR_BIT)
+		{
+		for (Digit = 0; Digit <= BYTE_MAX; ++Digit)
+			Buckets [Digit] = 0;
+		for (Position = 0; Position < Candidates; ++Position)
+			++Buckets [(Key [Position] >> Shift) & BYTE_MAX];
+		if (Buckets [(Key [0] >> Shift) & BYTE_MAX] == Candidates)
+			continue;
+		for (Sum = 0, Digit = 0; Digit <= BYTE_MAX; ++Digit)
+			{
+			Sum += Buckets [Digit];
+			Buckets [Digit] = Sum - Buckets [Digit];
+			}
+		for (Position = 0; Position < Candidates; ++Position)
+			{
+			Digit = (Key [Position] >> Shift) & BYTE_MAX;
+			OtherIndex [Buckets [Digit]] = Index [Position];
+			OtherKey [Buckets [Digit]++] = Key [Position];
+			}
+		SwapIndex = Index;
+		Index = OtherIndex;
+		OtherIndex = SwapIndex;
+		SwapKey = Key;
+		Key = OtherKey;
+		OtherKey = SwapKey;
+		}
+	if (Index != &OrderedIndex [0])
+		{
+		memcpy(OtherIndex, Index, Candidates * sizeof(std_uint));
+		Index = OtherIndex;
+		}
+	if (Fields == Values)
+		return;
+	for (First = 0, Position = 1; Position <= Candidates; ++Position)
+		if (Position == Candidates or Key [Position] != Key [First])
+			{
+			SortRange(Index + First, Position - First);
+			First = Position;
+			}
+	}
+
+}
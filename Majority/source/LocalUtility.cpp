@@ -40,12 +40,22 @@ static	std_uint	ReadNumber(register File& ParametersFile,
 				std_uint RecordIndex) throw(FatalException,
 				IOException, ApplicationException);
 
-static	bool		ReadEncodedKey(File& ParametersFile,
+static	void		ReadEncodedKey(File& ParametersFile,
 				std_uint RecordIndex,
-				const byte Key [ENCRYPTION_KEY_LENGTH])
+				byte Buffer [2 * ENCRYPTION_KEY_LENGTH])
 				throw(FatalException, IOException,
 				ApplicationException);
 
+static	bool		CheckEncodedKey(byte Buffer
+				[2 * ENCRYPTION_KEY_LENGTH],
+				const byte Key [ENCRYPTION_KEY_LENGTH],
+				std_uint Engine) throw(FatalException);
+
+static	bool		IsPlainEncodedKey(const byte Buffer
+				[2 * ENCRYPTION_KEY_LENGTH],
+				const byte Key [ENCRYPTION_KEY_LENGTH])
+				noexcept;
+
 static	std_uint	MixKeys(register const byte VotersKey
 				[ENCRYPTION_KEY_LENGTH], register const byte
 				VotesKey [ENCRYPTION_KEY_LENGTH],
@@ -190,13 +200,15 @@ static	std_uint	ReadNumber(register File& ParametersFile,
 
 ////////////////////////////////////////////////////////////////////////////////
 //! \par	Description:
-//!	Read a key from a file, and check it. \n
+//!	Read an encoded key from a file. \n
 //!	The key has been mixed with random bytes and encoded with itself.
 //!
 //! \param	ParametersFile				Reference to the file.
 //! \param	RecordIndex				Index of the record in
 //!							the file.
-//! \param	Key					The expected key.
+//! \param	Buffer					Array that upon return
+//!							will contain the encoded
+//!							key.
 //!
 //! \throw	utility_space::OUT_OF_MEMORY		If memory allocation
 //!							fails when creating an
@@ -221,8 +233,7 @@ static	std_uint	ReadNumber(register File& ParametersFile,
 //!							it contains extra
 //!							characters.
 //!
-//! \returns	bool					True, if the key is
-//!							correct.
+//! \returns	None.
 //!
 //! \note
 //!	The function reads a line from the file, expecting it to contain only
@@ -233,14 +244,11 @@ static	std_uint	ReadNumber(register File& ParametersFile,
 //!
 ////////////////////////////////////////////////////////////////////////////////
 
-static	bool	ReadEncodedKey(File& ParametersFile, std_uint RecordIndex,
-			register const byte Key [ENCRYPTION_KEY_LENGTH])
+static	void	ReadEncodedKey(File& ParametersFile, std_uint RecordIndex,
+			byte Buffer [2 * ENCRYPTION_KEY_LENGTH])
 			throw(FatalException, IOException, ApplicationException)
 	{
-	register	std_uint	Index;
-			byte		Buffer [2 * ENCRYPTION_KEY_LENGTH];
-			CharString	Line;
-			Cryptography	Encoder;
+	CharString	Line;
 
 	ParametersFile.ReadLine<char>(Line);
 	try
@@ -254,23 +262,65 @@ static	bool	ReadEncodedKey(File& ParametersFile, std_uint RecordIndex,
 		throw make_application_index_exception(
 			CORRUPTED_PARAMETERS_FILE, RecordIndex);
 		}
-printf("B1=");
-for (Index = 0; Index < 16; ++Index)
-	printf(" %02x", Buffer [Index * 2]);
-printf("\n");
+	}
+
+////////////////////////////////////////////////////////////////////////////////
+//! \par	Description:
+//!	Check an encoded key, decoding it with the expected key.
+//!
+//! \param	Buffer				Array that contains the encoded key;
+//!					it is overwritten with the decoded
+//!					data.
+//! \param	Key				The expected key.
+//! \param	Engine				Identifier of the cipher engine used
+//!					to encode the key.
+//!
+//! \throw	utility_space::ILLEGAL_ARGUMENT	If the engine is not valid or it is
+//!					not supported by the processor.
+//!
+//! \returns	bool				True, if the key is correct.
+//!
+//! \see	ENCRYPTION_KEY_LENGTH
+//! \see	ENCRYPTION_BLOCK_LENGTH
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+static	bool	CheckEncodedKey(byte Buffer [2 * ENCRYPTION_KEY_LENGTH],
+			register const byte Key [ENCRYPTION_KEY_LENGTH],
+			std_uint Engine) throw(FatalException)
+	{
+	Cryptography	Encoder;
+
+	Encoder.SetEngine(Engine);
 	Encoder.SetKey(Key);
-	for (Index = 0; Index < 2 * ENCRYPTION_KEY_LENGTH /
-		ENCRYPTION_BLOCK_LENGTH; ++Index)
-		Encoder.Decrypt(Buffer + Index * ENCRYPTION_BLOCK_LENGTH,
-			Buffer + Index * ENCRYPTION_BLOCK_LENGTH);
-printf("B2=");
-for (Index = 0; Index < 16; ++Index)
-	printf(" %02x", Buffer [Index * 2]);
-printf("\n");
-printf("K=");
-for (Index = 0; Index < 16; ++Index)
-	printf(" %02x", Key [Index]);
-printf("\n");
+	Encoder.DecryptBlocks(Buffer, Buffer,
+		2 * ENCRYPTION_KEY_LENGTH / ENCRYPTION_BLOCK_LENGTH);
+	return IsPlainEncodedKey(Buffer, Key);
+	}
+
+////////////////////////////////////////////////////////////////////////////////
+//! \par	Description:
+//!	Check whether an encoded key has been written without encryption, as
+//!	the programs did before encryption was enabled.
+//!
+//! \param	Buffer		Array that contains the encoded key.
+//! \param	Key		The expected key.
+//!
+//! \throw	None.
+//!
+//! \returns	bool		True, if the key is in clear in the encoded key.
+//!
+//! \see	ENCRYPTION_KEY_LENGTH
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+static	bool	IsPlainEncodedKey(register const byte Buffer
+			[2 * ENCRYPTION_KEY_LENGTH],
+			register const byte Key [ENCRYPTION_KEY_LENGTH])
+			noexcept
+	{
+	register	std_uint	Index;
+
 	for (Index = 0; Index < ENCRYPTION_KEY_LENGTH; ++Index)
 		if (Key [Index] != Buffer [2 * Index])
 			return false;
@@ -343,6 +393,28 @@ static	std_uint	MixKeys(register const byte VotersKey
 //!							voters' file.
 //! \param	VotesKey				Encryption key for the
 //!							votes file.
+//! \param	Engine					Reference to the
+//!							variable that upon
+//!							return will contain the
+//!							identifier of the cipher
+//!							engine.
+//! \param	DecoyVotes				Reference to the
+//!							variable that upon
+//!							return will contain the
+//!							minimum number of votes
+//!							modified when a vote is
+//!							written.
+//! \param	SweepVotes				Reference to the
+//!							variable that upon
+//!							return will contain the
+//!							number of votes modified
+//!							at each iteration of the
+//!							noise generation.
+//! \param	Shards					Reference to the
+//!							variable that upon
+//!							return will contain the
+//!							number of files the
+//!							votes are split into.
 //!
 //! \throw	utility_space::OUT_OF_MEMORY		If memory allocation
 //!							fails when creating an
@@ -375,10 +447,33 @@ static	std_uint	MixKeys(register const byte VotersKey
 //!							valid range or if there
 //!							are extra caracters in
 //!							the file.
+//! \throw	application_space::UNSUPPORTED_CIPHER_ENGINE	If the cipher
+//!							engine is not supported
+//!							by the processor.
 //!
 //! \returns	None.
 //!
+//! \note
+//!	If the file does not contain the cipher engine, as files created before
+//!	the AES engine was introduced, the Feistel engine is used; files created
+//!	before encryption was enabled contain the keys in clear and use the
+//!	pass-through engine, so that their elections can still be voted and
+//!	closed. \n
+//!	If the file does not contain the number of decoy votes and the number of
+//!	votes modified by the noise generation, as files created before they
+//!	were selectable, RANDOM_VOTES and DEFAULT_SWEEP_VOTES are used; if it
+//!	does not contain the number of files the votes are split into, the votes
+//!	are in a single file.
+//!
 //! \see	ENCRYPTION_KEY_LENGTH
+//! \see	FEISTEL_ENGINE
+//! \see	PLAIN_ENGINE
+//! \see	RANDOM_VOTES
+//! \see	MINIMUM_DECOY_VOTES
+//! \see	DEFAULT_SWEEP_VOTES
+//! \see	MAXIMUM_SWEEP_VOTES
+//! \see	DEFAULT_SHARDS
+//! \see	MAXIMUM_SHARDS
 //!
 //! \fileformat
 //! \see	ParametersFileFormat
@@ -388,10 +483,13 @@ static	std_uint	MixKeys(register const byte VotersKey
 void	ReadParameters(const CharString& DirectoryPath, std_uint& Candidates,
 		std_uint& Voters, std_uint& MaximumVote,
 		const byte VotersKey [ENCRYPTION_KEY_LENGTH],
-		const byte VotesKey [ENCRYPTION_KEY_LENGTH])
+		const byte VotesKey [ENCRYPTION_KEY_LENGTH], std_uint& Engine,
+		std_uint& DecoyVotes, std_uint& SweepVotes, std_uint& Shards)
 		throw(FatalException, IOException, ApplicationException)
 	{
 	File	ParametersFile;
+	byte	VotersBuffer [2 * ENCRYPTION_KEY_LENGTH];
+	byte	VotesBuffer [2 * ENCRYPTION_KEY_LENGTH];
 
 	ParametersFile.OpenText(MakeParametersPathName(DirectoryPath),
 		OPEN_READ);
@@ -407,10 +505,70 @@ void	ReadParameters(const CharString& DirectoryPath, std_uint& Candidates,
 	if (MaximumVote < MINIMUM_VOTE or MaximumVote > MAXIMUM_VOTE)
 		throw make_application_index_exception(
 			CORRUPTED_PARAMETERS_FILE, 2);
-	if (not ReadEncodedKey(ParametersFile, 4, VotersKey))
+	ReadEncodedKey(ParametersFile, 3, VotersBuffer);
+	ReadEncodedKey(ParametersFile, 4, VotesBuffer);
+	try
+		{
+		Engine = ReadNumber(ParametersFile, 5);
+		if (Engine > MAXIMUM_ENGINE)
+			throw make_application_index_exception(
+				CORRUPTED_PARAMETERS_FILE, 5);
+		}
+	catch (IOException Exc)
+		{
+		if (Exc.GetExceptionKind() != END_OF_FILE)
+			throw;
+		if (IsPlainEncodedKey(VotersBuffer, VotersKey) and
+			IsPlainEncodedKey(VotesBuffer, VotesKey))
+			Engine = PLAIN_ENGINE;
+		else
+			Engine = FEISTEL_ENGINE;
+		}
+	if (not Cryptography::IsEngineSupported(Engine))
+		throw make_application_exception(UNSUPPORTED_CIPHER_ENGINE);
+	if (not CheckEncodedKey(VotersBuffer, VotersKey, Engine))
 		throw make_application_exception(INVALID_VOTERS_KEY);
-	if (not ReadEncodedKey(ParametersFile, 4, VotesKey))
+	if (not CheckEncodedKey(VotesBuffer, VotesKey, Engine))
 		throw make_application_exception(INVALID_VOTES_KEY);
+	try
+		{
+		DecoyVotes = ReadNumber(ParametersFile, 6);
+		}
+	catch (IOException Exc)
+		{
+		if (Exc.GetExceptionKind() != END_OF_FILE)
+			throw;
+		DecoyVotes = RANDOM_VOTES;
+		}
+	if (DecoyVotes < MINIMUM_DECOY_VOTES or DecoyVotes > RANDOM_VOTES)
+		throw make_application_index_exception(
+			CORRUPTED_PARAMETERS_FILE, 6);
+	try
+		{
+		SweepVotes = ReadNumber(ParametersFile, 7);
+		}
+	catch (IOException Exc)
+		{
+		if (Exc.GetExceptionKind() != END_OF_FILE)
+			throw;
+		SweepVotes = DEFAULT_SWEEP_VOTES;
+		}
+	if (SweepVotes == 0 or SweepVotes > MAXIMUM_SWEEP_VOTES)
+		throw make_application_index_exception(
+			CORRUPTED_PARAMETERS_FILE, 7);
+	try
+		{
+		Shards = ReadNumber(ParametersFile, 8);
+		}
+	catch (IOException Exc)
+		{
+		if (Exc.GetExceptionKind() != END_OF_FILE)
+			throw;
+		Shards = DEFAULT_SHARDS;
+		}
+	if (Shards == 0 or Shards > MAXIMUM_SHARDS or Shards > Voters)
+		throw make_application_index_exception(
+			CORRUPTED_PARAMETERS_FILE, 8);
 	try
 		{
 		ignore_value(ParametersFile.ReadCharacter<char>());
@@ -424,7 +582,7 @@ void	ReadParameters(const CharString& DirectoryPath, std_uint& Candidates,
 			}
 		throw;
 		}
-	throw make_application_index_exception(CORRUPTED_PARAMETERS_FILE, 3);
+	throw make_application_index_exception(CORRUPTED_PARAMETERS_FILE, 9);
 	}
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -525,10 +683,13 @@ void	ReadKeys(const CharString& KeyPath,
 //!
 //! \param	Key		Array that contains the key.
 //! \param	Buffer		Array that will contain the encoded key
-//! \param	Generator	Reference to the random number generator used to
-//!				generate random bytes.
+//! \param	Generator			Reference to the random number
+//!					generator used to generate random
+//!					bytes.
+//! \param	Engine				Identifier of the cipher engine.
 //!
-//! \throw	None.
+//! \throw	utility_space::ILLEGAL_ARGUMENT	If the engine is not valid or it is
+//!					not supported by the processor.
 //!
 //! \returns	None.
 //!
@@ -540,25 +701,20 @@ void	ReadKeys(const CharString& KeyPath,
 
 void	EncodeKey(register const byte Key [ENCRYPTION_KEY_LENGTH],
 		char Buffer [4 * ENCRYPTION_KEY_LENGTH],
-		register RandomGenerator& Generator) noexcept
+		register RandomGenerator& Generator, std_uint Engine)
+		throw(FatalException)
 	{
 	register	std_uint	Index;
-	register	byte*		p;
 			byte		KeyBuffer [2 * ENCRYPTION_KEY_LENGTH];
 			Cryptography	Encoder;
 
+	Encoder.SetEngine(Engine);
 	Encoder.SetKey(Key);
-	p = KeyBuffer;
 	for (Index = 0; Index < ENCRYPTION_KEY_LENGTH; ++Index)
-		{
-		*p++ = Key [Index];
-		*p++ = Generator.Generate(BYTE_MAX);
-		}
-	for (Index = 0; Index < 2 * ENCRYPTION_KEY_LENGTH /
-		ENCRYPTION_BLOCK_LENGTH; ++Index)
-		Encoder.Crypt(KeyBuffer + Index * ENCRYPTION_BLOCK_LENGTH,
-			KeyBuffer + Index * ENCRYPTION_BLOCK_LENGTH);
-	p = KeyBuffer;
+		KeyBuffer [2 * Index] = Key [Index];
+	Generator.Fill(KeyBuffer + 1, ENCRYPTION_KEY_LENGTH, BYTE_MAX, 2);
+	Encoder.CryptBlocks(KeyBuffer, KeyBuffer,
+		2 * ENCRYPTION_KEY_LENGTH / ENCRYPTION_BLOCK_LENGTH);
 	EncodeHex(KeyBuffer, Buffer, 2 * ENCRYPTION_KEY_LENGTH);
 	}
 
@@ -602,8 +758,8 @@ void	InitializeGenerator(register RandomGenerator& Generator,
 	for (Index = 0; Index < LINEAR_GENERATORS; Index += 2)
 		SelectorSeed [Index] ^= Value;
 	Generator.SetSeeds(Seed, SelectorSeed);
-	for (Index = LINEAR_GENERATORS * (Seed + BYTE_MAX); Index-- > 0;)
-		ignore_value(Generator.Generate(BYTE_MAX));
+	Generator.Skip(LINEAR_GENERATORS * (static_cast<std_ulong>(Seed) +
+		BYTE_MAX));
 	}
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -63,7 +63,12 @@ static	void	Usage(void) throw(IOException)
 //! \par	Description:
 //!	Main program for noise generation votes. \n
 //!	It keeps generating random noise, that is, changing the filler parts of
-//!	randomly selected votes, until it is killed.
+//!	randomly selected votes, until it is killed or the given number of
+//!	iterations, if not zero, is reached. \n
+//!	Each iteration changes the number of votes set in the election
+//!	parameters file, so that the rate of the noise, together with the
+//!	number of votes changed when a vote is written, can be tuned for each
+//!	election.
 //!
 //! \param	argc	Number of command line arguments.
 //! \param	argv	Array of command line arguments.
@@ -75,7 +80,8 @@ static	void	Usage(void) throw(IOException)
 //!
 //! \see	ENCRYPTION_KEY_LENGTH
 //! \see	MILLISECONDS_PER_SECOND
-//! \def	MAXIMUM_NOISE_INTERVAL
+//! \see	MAXIMUM_NOISE_INTERVAL
+//! \see	DEFAULT_SWEEP_VOTES
 //!
 ////////////////////////////////////////////////////////////////////////////////
 
@@ -88,6 +94,10 @@ int	main(int argc, char* argv [])
 		register	std_uint	TimeInterval;
 				std_uint	Candidates;
 				std_uint	MaximumVote;
+				std_uint	Engine;
+				std_uint	DecoyVotes;
+				std_uint	SweepVotes;
+				std_uint	Shards;
 				CharString	DirectoryPath;
 				CharString	KeyPath;
 				RandomGenerator	Generator;
@@ -118,18 +128,21 @@ int	main(int argc, char* argv [])
 			TimeInterval = 1;
 		ReadKeys(KeyPath, VotersKey, VotesKey);
 		ReadParameters(DirectoryPath, Candidates, Voters, MaximumVote,
-			VotersKey, VotesKey);
+			VotersKey, VotesKey, Engine, DecoyVotes, SweepVotes,
+			Shards);
 		InitializeGenerator(Generator, VotersKey, VotesKey);
 		CurrentVotesFile.Open(MakeVotesPathName(DirectoryPath),
-			Candidates, Voters, MaximumVote, VotesKey);
-		--Voters;
+			Candidates, Voters, MaximumVote, Shards, VotesKey,
+			Engine);
+		CurrentVotesFile.OpenLocks(MakeLocksPathName(DirectoryPath));
 		TimeInterval *= MILLISECONDS_PER_SECOND;
-		for (; Iterations > 0; --Iterations)
+		for (;;)
 			{
-			CurrentVotesFile.Modify(Generator.Generate(Voters),
-				Generator);
+			CurrentVotesFile.Sweep(SweepVotes, Generator);
 			CurrentVotesFile.SystemFlush();
 			SystemManager::GetInstance()->Sleep(TimeInterval);
+			if (Iterations > 0 and --Iterations == 0)
+				break;
 			}
 		CurrentVotesFile.Close();
 		}
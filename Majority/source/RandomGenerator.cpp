@@ -17,9 +17,72 @@
 # include	"RandomGenerator.inl"
 # endif
 
+//! \def	STREAM_INCREMENT
+//!	Constant, close to 2 ^ 32 divided by the golden ratio and prime to all
+//!	the modules, multiplied by the number of the sub-stream when deriving
+//!	the seeds of a sub-stream.
+# define	STREAM_INCREMENT		0x9E3779B9
+
+//! \def	FIRST_MIX_MULTIPLIER
+//!	First multiplier of the function used to mix the seeds of a sub-stream.
+# define	FIRST_MIX_MULTIPLIER		0x7FEB352D
+
+//! \def	SECOND_MIX_MULTIPLIER
+//!	Second multiplier of the function used to mix the seeds of a sub-stream.
+# define	SECOND_MIX_MULTIPLIER		0x846CA68B
+
 namespace	utility_space
 {
 
+////////////////////////////////////////////////////////////////////////////////
+//! \par	Description:
+//!	Compute the seed of a linear generator of a sub-stream.
+//!
+//! \param	Seed		Current seed of the generator in the parent
+//!				stream.
+//! \param	Stream		Number of the sub-stream.
+//! \param	Module		Module of the generator.
+//!
+//! \throw	None.
+//!
+//! \returns	std_uint	The seed, less than Module.
+//!
+//! \note
+//!	A multiple of the stream number is added to the seed, modulo Module,
+//!	then the sum is mixed by a permutation of the 32 bits numbers, repeated
+//!	until the result is less than Module; the repetition makes the mixing a
+//!	permutation of the numbers less than Module. \n
+//!	So, for a given stream, different parent seeds give different seeds
+//!	and, for a given parent seed, different streams give different seeds,
+//!	if their difference is less than Module; seeds that differ by a
+//!	multiple of Module are equivalent, since they generate the same numbers.
+//!
+//! \see	STREAM_INCREMENT
+//! \see	FIRST_MIX_MULTIPLIER
+//! \see	SECOND_MIX_MULTIPLIER
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+LOCAL	std_uint	MixSeed(std_uint Seed, std_uint Stream,
+				std_uint Module) noexcept
+	{
+	register	std_uint	Value;
+
+	Value = static_cast<std_uint>((Seed % Module +
+		(static_cast<std_ulong>(Stream) + 1) * STREAM_INCREMENT) %
+		Module);
+	do
+		{
+		Value ^= Value >> 16;
+		Value *= FIRST_MIX_MULTIPLIER;
+		Value ^= Value >> 15;
+		Value *= SECOND_MIX_MULTIPLIER;
+		Value ^= Value >> 16;
+		}
+	while (Value >= Module);
+	return Value;
+	}
+
 const	RandomGenerator::GeneratorData	RandomGenerator::Data
 						[LINEAR_GENERATORS] =
 	{
@@ -134,6 +197,10 @@ const	RandomGenerator::GeneratorData	RandomGenerator::Data
 //!
 //! \returns	Not applicable.
 //!
+//! \note
+//!	Every module of the linear generators must be greater than BYTE_MAX,
+//!	since Fill generates bytes without checking the modules.
+//!
 ////////////////////////////////////////////////////////////////////////////////
 
 RandomGenerator::RandomGenerator(void) noexcept: RandomSelector(),
@@ -142,8 +209,11 @@ RandomGenerator::RandomGenerator(void) noexcept: RandomSelector(),
 	register	std_uint	i;
 
 	for (i = 0; i < number_of_elements(GeneratorArray); ++i)
+		{
+		assert(Data [i].Module > BYTE_MAX);
 		GeneratorArray [i].SetParameters(Data [i].Multiplier,
-		Data [i].Constant, Data [i].Module);
+			Data [i].Constant, Data [i].Module);
+		}
 	}
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -171,4 +241,76 @@ void	RandomGenerator::SetSeeds(std_uint SelectorSeed,
 		GeneratorArray [i].SetSeed(*Seed++);
 	}
 
+////////////////////////////////////////////////////////////////////////////////
+//! \par	Description:
+//!	Advance a random number generator by a given number of generations,
+//!	without generating the intermediate numbers. \n
+//!	The RandomSelector generator is advanced by Steps steps, each of the
+//!	linear generators by the number of times it is selected, on average,
+//!	in Steps generations.
+//!
+//! \param	Steps	The number of generations.
+//!
+//! \throw	None.
+//!
+//! \returns	None.
+//!
+//! \note
+//!	The state reached is not the same reached calling Steps times Generate,
+//!	which depends upon the sequence of selected generators and upon the
+//!	numbers discarded to ensure equal probability; it is the same for any
+//!	given seeds and Steps.
+//!
+//! \see	LINEAR_GENERATORS
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+void	RandomGenerator::Skip(std_ulong Steps) noexcept
+	{
+	register	std_uint	i;
+
+	RandomSelector.Skip(Steps);
+	for (i = 0; i < number_of_elements(GeneratorArray); ++i)
+		GeneratorArray [i].Skip(Steps / LINEAR_GENERATORS);
+	}
+
+////////////////////////////////////////////////////////////////////////////////
+//! \par	Description:
+//!	Derive an independent sub-stream from a random number generator. \n
+//!	The seeds of the sub-stream are computed from the current seeds of the
+//!	generator and from the number of the sub-stream; the generator itself is
+//!	not changed, so that any number of sub-streams can be derived, for
+//!	example one for each thread or for each range of voters, and each of
+//!	them can be used without locking.
+//!
+//! \param	Stream		Number of the sub-stream.
+//! \param	SubStream	Reference to the generator that upon return will
+//!				generate the sub-stream.
+//!
+//! \throw	None.
+//!
+//! \returns	None.
+//!
+//! \note
+//!	The same seeds and Stream always give the same sub-stream, that can be
+//!	split again. \n
+//!	Skip cannot be used to separate the sub-streams, since the cycle of each
+//!	linear generator is shorter than 2 ^ 32 numbers.
+//!
+//! \see	LINEAR_GENERATORS
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+void	RandomGenerator::Split(std_uint Stream, RandomGenerator& SubStream)
+		const noexcept
+	{
+	register	std_uint	i;
+
+	SubStream.RandomSelector.SetSeed(MixSeed(RandomSelector.GetSeed(),
+		Stream, DEFAULT_MODULE));
+	for (i = 0; i < number_of_elements(GeneratorArray); ++i)
+		SubStream.GeneratorArray [i].SetSeed(MixSeed(
+			GeneratorArray [i].GetSeed(), Stream, Data [i].Module));
+	}
+
 }
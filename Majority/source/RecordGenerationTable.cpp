@@ -0,0 +1,141 @@
+////////////////////////////////////////////////////////////////////////////////
+//! \file
+//!
+//! \author	agent
+//!
+//! \date	17/10/2026
+//!
+//! \par	Function:
+//!	It contains the definitions of static attributes and non inline
+//!	functions of the io_space::RecordGenerationTable class.
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+# include	"Standard.h"
+# include	"RecordGenerationTable.h"
+
+# if !defined	USE_INLINE
+# include	"RecordGenerationTable.inl"
+# endif
+
+namespace	io_space
+{
+
+using	namespace	utility_space;
+using	namespace	application_space;
+
+////////////////////////////////////////////////////////////////////////////////
+//! \par	Description:
+//!	Create a file containing a table of generations, all equal to zero.
+//!
+//! \param	thisPathName				Reference to the path
+//!							name of the file.
+//! \param	thisVoters				Number of voters.
+//!
+//! \throw	utility_space::OUT_OF_MEMORY		If memory allocation
+//!							fails.
+//! \throw	io_space::FILE_INVALID_PATH_NAME	If the path name is not
+//!							valid.
+//! \throw	io_space::FILE_PERMISSION_DENIED	If user has no
+//!							permission to open the
+//!							file or if the path name
+//!							corresponds to a
+//!							directory.
+//! \throw	io_space::TOO_MANY_OPEN_FILES		If trying to open too
+//!							many files.
+//! \throw	io_space::FILE_WRITE_ERROR		If an error occurs while
+//!							writing.
+//! \throw	io_space::FILE_CLOSE_ERROR		If an error occurs while
+//!							closing the file.
+//!
+//! \returns	None.
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+void	RecordGenerationTable::Create(const CharString& thisPathName,
+		std_uint thisVoters) throw(FatalException, IOException)
+	{
+	register	std_uint	Voter;
+			std_uint	Generation;
+
+	Generation = 0;
+	OpenBinary(thisPathName, OPEN_WRITE, MAXIMUM_BUFFER_SIZE);
+	for (Voter = 0; Voter < thisVoters; ++Voter)
+		Write(&Generation, sizeof(Generation), 1);
+	File::Close();
+	}
+
+////////////////////////////////////////////////////////////////////////////////
+//! \par	Description:
+//!	Open the table of generations and map it in memory.
+//!
+//! \param	thisPathName				Path name of the file to
+//!							be opened.
+//! \param	thisVoters				Number of voters.
+//!
+//! \throw	utility_space::OUT_OF_MEMORY		If memory allocation
+//!							fails.
+//! \throw	io_space::FILE_ALREADY_OPEN		If File is already open.
+//! \throw	io_space::FILE_INVALID_PATH_NAME	If the path name is not
+//!							valid.
+//! \throw	io_space::FILE_DOES_NOT_EXIST		If the file does not
+//!							exist.
+//! \throw	io_space::FILE_PERMISSION_DENIED	If user has no
+//!							permission to open the
+//!							file or if the path name
+//!							corresponds to a
+//!							directory.
+//! \throw	io_space::TOO_MANY_OPEN_FILES		If trying to open too
+//!							many files.
+//! \throw	io_space::FILE_IO_ERROR			If the file cannot be
+//!							mapped.
+//! \throw	application_space::INVALID_GENERATIONS_FILE_LENGTH	If the
+//!							file length is not
+//!							correct.
+//!
+//! \returns	None.
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+void	RecordGenerationTable::Open(const CharString& thisPathName,
+		std_uint thisVoters)
+		throw(FatalException, IOException, ApplicationException)
+	{
+	if (FileManager::GetInstance()->GetFileSize(thisPathName) !=
+		static_cast<std_ulong>(thisVoters) * sizeof(std_uint))
+		throw make_application_exception(
+			INVALID_GENERATIONS_FILE_LENGTH);
+	OpenBinary(thisPathName, OPEN_UPDATE);
+	MappedGenerations = static_cast<std_uint*>(Map(
+		static_cast<std_ulong>(thisVoters) * sizeof(std_uint)));
+	Voters = thisVoters;
+	}
+
+////////////////////////////////////////////////////////////////////////////////
+//! \par	Description:
+//!	Remove the mapping of the table and close it.
+//!
+//! \throw	utility_space::OUT_OF_MEMORY		If memory allocation
+//!							fails when creating an
+//!							exception.
+//! \throw	io_space::FILE_NOT_OPEN			If the table is not
+//!							opened.
+//! \throw	io_space::FILE_CLOSE_ERROR		If an error occurs while
+//!							closing the file.
+//!
+//! \returns	None.
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+void	RecordGenerationTable::Close(void) throw(FatalException, IOException)
+	{
+	if (MappedGenerations != nullptr)
+		{
+		Unmap(MappedGenerations, static_cast<std_ulong>(Voters) *
+			sizeof(std_uint));
+		MappedGenerations = nullptr;
+		}
+	File::Close();
+	}
+
+}
@@ -0,0 +1,266 @@
+////////////////////////////////////////////////////////////////////////////////
+//! \file
+//!
+//! \author	agent
+//!
+//! \date	16/10/2026
+//!
+//! \par	Function:
+//!	It contains the definitions of static attributes and non inline
+//!	functions of the io_space::RecordLockTable class.
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+# include	"Standard.h"
+# include	"RecordLockTable.h"
+
+# if !defined	USE_INLINE
+# include	"RecordLockTable.inl"
+# endif
+
+//! \def	STRIPE_WORD_BITS
+//!	Number of locks represented by an element of the bit map of the locks
+//!	held.
+# define	STRIPE_WORD_BITS		(sizeof(std_ulong) * BYTE_BITS)
+
+namespace	io_space
+{
+
+using	namespace	utility_space;
+using	namespace	application_space;
+using	namespace	system_space;
+
+////////////////////////////////////////////////////////////////////////////////
+//! \par	Description:
+//!	Initialize the locks of the mapped table, unless they have already been
+//!	initialized since the system has been started.
+//!
+//! \throw	utility_space::OUT_OF_MEMORY	If memory allocation fails.
+//! \throw	io_space::FILE_NOT_OPEN		If the File is not opened.
+//! \throw	io_space::FILE_IO_ERROR		If an error occurs while locking
+//!						the header.
+//! \throw	io_space::TOO_MANY_LOCKS	If the locks cannot be created.
+//!
+//! \returns	None.
+//!
+//! \note
+//!	The header is protected by a file lock, so that only the first process
+//!	opening the table after a system start initializes it; the locks left
+//!	by a previous boot may look held by processes no longer existing.
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+void	RecordLockTable::Initialize(void) throw(FatalException, IOException)
+	{
+	register	LockTableHeader*	Header;
+	register	std_ulong		BootIdentifier;
+	register	std_uint		Stripe;
+
+	Header = reinterpret_cast<LockTableHeader*>(MappedTable);
+	BootIdentifier = SystemManager::GetInstance()->GetBootIdentifier();
+	LockAt(0, SHARED_LOCK_SIZE);
+	if (Header->Magic != LOCK_TABLE_MAGIC or
+		Header->BootIdentifier != BootIdentifier)
+		{
+		Header->Magic = 0;
+		for (Stripe = 0; Stripe < LOCK_STRIPES; ++Stripe)
+			if (not SystemManager::GetInstance()->
+				InitializeSharedLock(GetLock(Stripe)))
+				{
+				UnlockAt(0, SHARED_LOCK_SIZE);
+				throw make_IO_exception(TOO_MANY_LOCKS,
+					GetPathName());
+				}
+		Header->BootIdentifier = BootIdentifier;
+		Header->Magic = LOCK_TABLE_MAGIC;
+		}
+	UnlockAt(0, SHARED_LOCK_SIZE);
+	}
+
+////////////////////////////////////////////////////////////////////////////////
+//! \par	Description:
+//!	Create a file containing an uninitialized lock table.
+//!
+//! \param	thisPathName				Reference to the path
+//!							name of the file.
+//!
+//! \throw	utility_space::OUT_OF_MEMORY		If memory allocation
+//!							fails.
+//! \throw	io_space::FILE_INVALID_PATH_NAME	If the path name is not
+//!							valid.
+//! \throw	io_space::FILE_PERMISSION_DENIED	If user has no
+//!							permission to open the
+//!							file or if the path name
+//!							corresponds to a
+//!							directory.
+//! \throw	io_space::TOO_MANY_OPEN_FILES		If trying to open too
+//!							many files.
+//! \throw	io_space::FILE_WRITE_ERROR		If an error occurs while
+//!							writing.
+//! \throw	io_space::FILE_CLOSE_ERROR		If an error occurs while
+//!							closing the file.
+//!
+//! \returns	None.
+//!
+//! \see	LOCK_TABLE_LENGTH
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+void	RecordLockTable::Create(const CharString& thisPathName)
+		throw(FatalException, IOException)
+	{
+	register	std_uint	Stripe;
+			byte		Buffer [SHARED_LOCK_SIZE];
+
+	ignore_value(memset(Buffer, 0, sizeof(Buffer)));
+	OpenBinary(thisPathName, OPEN_WRITE, MAXIMUM_BUFFER_SIZE);
+	for (Stripe = 0; Stripe <= LOCK_STRIPES; ++Stripe)
+		Write(Buffer, 1, sizeof(Buffer));
+	File::Close();
+	}
+
+////////////////////////////////////////////////////////////////////////////////
+//! \par	Description:
+//!	Open the lock table, map it in memory and initialize it, if needed.
+//!
+//! \param	thisPathName				Path name of the file to
+//!							be opened.
+//!
+//! \throw	utility_space::OUT_OF_MEMORY		If memory allocation
+//!							fails.
+//! \throw	io_space::FILE_ALREADY_OPEN		If File is already open.
+//! \throw	io_space::FILE_INVALID_PATH_NAME	If the path name is not
+//!							valid.
+//! \throw	io_space::FILE_DOES_NOT_EXIST		If the file does not
+//!							exist.
+//! \throw	io_space::FILE_PERMISSION_DENIED	If user has no
+//!							permission to open the
+//!							file or if the path name
+//!							corresponds to a
+//!							directory.
+//! \throw	io_space::TOO_MANY_OPEN_FILES		If trying to open too
+//!							many files.
+//! \throw	io_space::FILE_IO_ERROR			If the file cannot be
+//!							mapped.
+//! \throw	io_space::TOO_MANY_LOCKS		If the locks cannot be
+//!							created.
+//! \throw	application_space::INVALID_LOCKS_FILE_LENGTH	If the file
+//!							length is not correct.
+//!
+//! \returns	None.
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+void	RecordLockTable::Open(const CharString& thisPathName)
+		throw(FatalException, IOException, ApplicationException)
+	{
+	if (FileManager::GetInstance()->GetFileSize(thisPathName) !=
+		LOCK_TABLE_LENGTH)
+		throw make_application_exception(INVALID_LOCKS_FILE_LENGTH);
+	OpenBinary(thisPathName, OPEN_UPDATE);
+	MappedTable = static_cast<byte*>(Map(LOCK_TABLE_LENGTH));
+	ignore_value(memset(LockedStripes, 0, sizeof(LockedStripes)));
+	Initialize();
+	}
+
+////////////////////////////////////////////////////////////////////////////////
+//! \par	Description:
+//!	Acquire the locks protecting a set of records, waiting until they are
+//!	released by other processes.
+//!
+//! \param	Records		Array containing the indices of the records.
+//! \param	Count		Number of records.
+//!
+//! \throw	None.
+//!
+//! \returns	None.
+//!
+//! \note
+//!	Every lock is acquired once, even if it protects several records, and
+//!	the locks are always acquired in increasing order, so that processes
+//!	locking overlapping sets of records cannot deadlock; hence all the locks
+//!	must be released by Unlock before acquiring other ones. \n
+//!	A lock held by a process terminated is acquired anyway: as with file
+//!	locks, the records it was rewriting are not recovered.
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+void	RecordLockTable::Lock(register const std_uint* Records,
+		register std_uint Count) noexcept
+	{
+	register	std_uint	Stripe;
+	register	std_uint	Word;
+
+	for (; Count > 0; --Count)
+		{
+		Stripe = *Records++ % LOCK_STRIPES;
+		LockedStripes [Stripe / STRIPE_WORD_BITS] |=
+			static_cast<std_ulong>(1) << Stripe % STRIPE_WORD_BITS;
+		}
+	for (Word = 0; Word < LOCK_STRIPES / STRIPE_WORD_BITS; ++Word)
+		if (LockedStripes [Word] != 0)
+			for (Stripe = 0; Stripe < STRIPE_WORD_BITS; ++Stripe)
+				if ((LockedStripes [Word] >> Stripe & 1) != 0)
+					ignore_value(SystemManager::
+						GetInstance()->
+						AcquireSharedLock(GetLock(
+						Word * STRIPE_WORD_BITS +
+						Stripe)));
+	}
+
+////////////////////////////////////////////////////////////////////////////////
+//! \par	Description:
+//!	Release all the locks acquired by Lock.
+//!
+//! \throw	None.
+//!
+//! \returns	None.
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+void	RecordLockTable::Unlock(void) noexcept
+	{
+	register	std_uint	Stripe;
+	register	std_uint	Word;
+
+	for (Word = 0; Word < LOCK_STRIPES / STRIPE_WORD_BITS; ++Word)
+		if (LockedStripes [Word] != 0)
+			{
+			for (Stripe = 0; Stripe < STRIPE_WORD_BITS; ++Stripe)
+				if ((LockedStripes [Word] >> Stripe & 1) != 0)
+					SystemManager::GetInstance()->
+						ReleaseSharedLock(GetLock(
+						Word * STRIPE_WORD_BITS +
+						Stripe));
+			LockedStripes [Word] = 0;
+			}
+	}
+
+////////////////////////////////////////////////////////////////////////////////
+//! \par	Description:
+//!	Release the locks held, remove the mapping of the table and close it.
+//!
+//! \throw	utility_space::OUT_OF_MEMORY		If memory allocation
+//!							fails when creating an
+//!							exception.
+//! \throw	io_space::FILE_NOT_OPEN			If the table is not
+//!							opened.
+//! \throw	io_space::FILE_CLOSE_ERROR		If an error occurs while
+//!							closing the file.
+//!
+//! \returns	None.
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+void	RecordLockTable::Close(void) throw(FatalException, IOException)
+	{
+	if (MappedTable != nullptr)
+		{
+		Unlock();
+		Unmap(MappedTable, LOCK_TABLE_LENGTH);
+		MappedTable = nullptr;
+		}
+	File::Close();
+	}
+
+}
@@ -16,6 +16,10 @@
 # include	<string.h>
 # include	<time.h>
 
+# include	<thread>
+# include	<exception>
+# include	<system_error>
+
 # include	"Standard.h"
 # include	"Parameter.h"
 # include	"Message.h"
@@ -26,10 +30,11 @@
 # include	"GenericString.h"
 # include	"CharacterManager.h"
 # include	"SystemManager.h"
-# include	"CandidateVote.h"
+# include	"FileManager.h"
+# include	"ElectionTally.h"
 # include	"VotesFile.h"
+# include	"VoteJournal.h"
 # include	"Vector.h"
-# include	"OrderedVector.h"
 # include	"Utility.h"
 
 using	namespace	utility_space;
@@ -38,16 +43,74 @@ using	namespace	io_space;
 using	namespace	application_space;
 using	namespace	system_space;
 
+////////////////////////////////////////////////////////////////////////////////
+//! \struct	TallyData
+//!	The TallyData struct contains the range of voters read by a thread and
+//!	the votes counted in the range; when the result is computed
+//!	periodically, it is kept from a computation to the next one, together
+//!	with the votes counted, so that only the votes written in the meantime
+//!	are read again.
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+struct	TallyData
+	{
+//! \property	FirstVoter
+//!	Index of the first voter of the range.
+	std_uint		FirstVoter;
+
+//! \property	LastVoter
+//!	Index of the voter following the last one of the range.
+	std_uint		LastVoter;
+
+//! \property	Votes
+//!	Number of voters of the range who have voted.
+	std_uint		Votes;
+
+//! \property	ElectionVote
+//!	Numbers of votes of each candidate in the range.
+	ElectionTally		ElectionVote;
+
+//! \property	Generations
+//!	Generations of the votes of the range counted, used only when the
+//!	result is computed periodically.
+	Vector<std_uint>	Generations;
+
+//! \property	Ballots
+//!	Decrypted votes of the range counted, used only when the result is
+//!	computed periodically.
+	Vector<byte>		Ballots;
+
+//! \property	Error
+//!	Exception thrown while reading the range, if any.
+	std::exception_ptr	Error;
+	};
+
 static	void	Usage(void) throw(IOException);
 
+static	void	TallyThread(const CharString& DirectoryPath,
+			std_uint Candidates, std_uint Voters,
+			std_uint MaximumVote,
+			const byte VotesKey [ENCRYPTION_KEY_LENGTH],
+			std_uint Engine, std_uint Shards, bool Incremental,
+			TallyData& Tally) noexcept;
+
 static	void	ComputeResult(const CharString& DirectoryPath,
 			register std_uint Candidates, register std_uint Voters,
 			register std_uint MaximumVote,
 			const byte VotersKey [ENCRYPTION_KEY_LENGTH],
-			const byte VotesKey [ENCRYPTION_KEY_LENGTH])
+			const byte VotesKey [ENCRYPTION_KEY_LENGTH],
+			std_uint Engine, std_uint DecoyVotes,
+			std_uint Shards, std_uint Threads,
+			bool Incremental, Vector<TallyData>& Tallies,
+			int Watch)
 			throw(FatalException, IOException,
 			ApplicationException);
 
+static	void	WaitForVotes(const CharString& JournalPath, int Watch,
+			std_uint TimeInterval)
+			throw(FatalException, IOException);
+
 ////////////////////////////////////////////////////////////////////////////////
 //! \par	Description:
 //!	Write on stdout a message explaining the usage of the program.
@@ -63,11 +126,76 @@ static	void	ComputeResult(const CharString& DirectoryPath,
 
 static	void	Usage(void) throw(IOException)
 	{
-	if (printf(RESULT_USAGE_FORMAT) < 0)
+	if (printf(RESULT_USAGE_FORMAT, THREADS_OPTION, WATCH_OPTION,
+		MAXIMUM_RESULT_THREADS, DEFAULT_RESULT_THREADS,
+		MAXIMUM_RESULT_INTERVAL, WATCH_OPTION) < 0)
 		throw make_IO_exception(FILE_WRITE_ERROR,
 			CharString(DEFAULT_STDOUT_PATHNAME));
 	}
 
+////////////////////////////////////////////////////////////////////////////////
+//! \par	Description:
+//!	Body of a thread counting the votes of a range of voters; the thread
+//!	opens the votes file on its own, so that it has its own file handles,
+//!	mapping and encoder.
+//!
+//! \param	DirectoryPath		Reference to the directory path name.
+//! \param	Candidates		Number of candidates.
+//! \param	Voters			Number of voters
+//! \param	MaximumVote		Maximum possible vote.
+//! \param	VotesKey		Array that contains the encryption key
+//!				of the votes file.
+//! \param	Engine			Identifier of the cipher engine.
+//! \param	Shards			Number of files the votes are split
+//!				into.
+//! \param	Incremental		True if the numbers of votes of the
+//!				range must be updated, reading only the
+//!				votes written since the previous call.
+//! \param	Tally			Reference to the struct containing the
+//!				range of voters, that upon return will
+//!				contain the numbers of votes or the
+//!				exception thrown.
+//!
+//! \throw	None.
+//!
+//! \returns	None.
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+static	void	TallyThread(const CharString& DirectoryPath,
+			std_uint Candidates, std_uint Voters,
+			std_uint MaximumVote,
+			const byte VotesKey [ENCRYPTION_KEY_LENGTH],
+			std_uint Engine, std_uint Shards, bool Incremental,
+			TallyData& Tally) noexcept
+	{
+	try
+		{
+		VotesFile	CurrentVotesFile;
+
+		CurrentVotesFile.Open(MakeVotesPathName(DirectoryPath),
+			Candidates, Voters, MaximumVote, Shards, VotesKey,
+			Engine);
+		if (Incremental)
+			{
+			CurrentVotesFile.OpenGenerations(
+				MakeGenerationsPathName(DirectoryPath));
+			CurrentVotesFile.RefreshVotes(Tally.FirstVoter,
+				Tally.LastVoter, Tally.ElectionVote,
+				Tally.Votes, Tally.Generations, Tally.Ballots);
+			}
+		else
+			Tally.Votes = CurrentVotesFile.CountVotes(
+				Tally.FirstVoter, Tally.LastVoter,
+				Tally.ElectionVote);
+		CurrentVotesFile.Close();
+		}
+	catch (...)
+		{
+		Tally.Error = std::current_exception();
+		}
+	}
+
 ////////////////////////////////////////////////////////////////////////////////
 //! \par	Description:
 //!	Compute and write the results.
@@ -83,6 +211,25 @@ static	void	Usage(void) throw(IOException)
 //! \param	VotesKey				Array that contains the
 //!							encryption key of the
 //!							votes file.
+//! \param	Engine					Identifier of the cipher
+//!							engine.
+//! \param	DecoyVotes				Minimum number of votes
+//!							modified when a vote is
+//!							written.
+//! \param	Shards					Number of files the
+//!							votes are split into.
+//! \param	Threads					Number of threads
+//!							reading the votes.
+//! \param	Incremental				True if the result is
+//!							computed periodically.
+//! \param	Tallies					Reference to the Vector
+//!							containing the ranges of
+//!							voters read by each
+//!							thread and their votes,
+//!							empty at the first call.
+//! \param	Watch					Value returned by
+//!							WatchFile for the
+//!							journal, or NO_WATCH.
 //!
 //! \throw	utility_space::OUT_OF_MEMORY		If memory allocation
 //!							fails.
@@ -124,6 +271,26 @@ static	void	Usage(void) throw(IOException)
 //!
 //! \returns	None.
 //!
+//! \note
+//!	The votes acknowledged through the journal are written into the votes
+//!	file before computing the result; the voting programs appending to the
+//!	journal meanwhile are delayed. The changes of the journal notified to
+//!	Watch while it is locked have been made by the program itself, hence
+//!	they are discarded.
+//!
+//! \note
+//!	The voters are split into Threads ranges of about the same size; the
+//!	first range is read by the calling thread, each other one by a thread
+//!	with its own votes file and numbers of votes, which are added together
+//!	when all the threads have finished. If a thread cannot be started, its
+//!	range is read by the calling thread.
+//!
+//! \note
+//!	If the result is computed periodically, the votes of each range are
+//!	kept in Tallies and at every call only the votes written since the
+//!	previous one are read again, if the election has a table of
+//!	generations; otherwise all the votes are read again.
+//!
 //! \see	ENCRYPTION_KEY_LENGTH
 //! \see	ELECTION_HEADER_FORMAT
 //! \see	ALL_VOTERS_MESSAGE
@@ -142,62 +309,124 @@ static	void	ComputeResult(const CharString& DirectoryPath,
 			register std_uint Candidates, register std_uint Voters,
 			register std_uint MaximumVote,
 			const byte VotersKey [ENCRYPTION_KEY_LENGTH],
-			const byte VotesKey [ENCRYPTION_KEY_LENGTH])
+			const byte VotesKey [ENCRYPTION_KEY_LENGTH],
+			std_uint Engine, std_uint DecoyVotes, std_uint Shards,
+			std_uint Threads, bool Incremental,
+			Vector<TallyData>& Tallies, int Watch)
 			throw(FatalException, IOException, ApplicationException)
 	{
 	register	std_uint		Index;
 	register	std_uint		Candidate;
 	register	std_uint		Value;
+	register	std_uint		Voted;
 	register	std_uint		Rank;
 			char			TimeBuffer [DATE_TIME_LENGTH];
 			time_t			Time;
 			VotesFile		CurrentVotesFile;
-			CandidateVote		LocalVote(MaximumVote);
-			Vector<std_uint>	CurrentVote;
-			Vector<CandidateVote>	ElectionVote;
+			VoteJournal		CurrentJournal;
+			RandomGenerator		FillerGenerator;
+			TallyData		LocalTally;
+			ElectionTally		ElectionVote(Candidates,
+							MaximumVote);
 			Vector<std_uint>	OrderedIndex(Candidates);
+			std::thread		Workers [MAXIMUM_RESULT_THREADS];
 
 	CurrentVotesFile.Open(MakeVotesPathName(DirectoryPath), Candidates,
-		Voters, MaximumVote, VotesKey);
-	ElectionVote.Resize(Candidates);
-	ElectionVote.Append(LocalVote, Candidates);
+		Voters, MaximumVote, Shards, VotesKey, Engine);
+	CurrentVotesFile.OpenGenerations(MakeGenerationsPathName(
+		DirectoryPath));
+	if (CurrentJournal.Open(MakeJournalPathName(DirectoryPath), Candidates,
+		VotesKey, Engine))
+		{
+		CurrentVotesFile.SetDecoyVotes(DecoyVotes);
+		CurrentVotesFile.OpenLocks(MakeLocksPathName(DirectoryPath));
+		InitializeGenerator(FillerGenerator, VotersKey, VotesKey);
+		CurrentJournal.Lock();
+		CurrentJournal.Apply(CurrentVotesFile, VotersKey, VotesKey,
+			FillerGenerator);
+		if (Watch != NO_WATCH)
+			ignore_value(FileManager::GetInstance()->WaitForChanges(
+				Watch, 0, MakeJournalPathName(DirectoryPath)));
+		CurrentJournal.Unlock();
+		CurrentJournal.Close();
+		}
 	Time = time(nullptr);
 	strftime(TimeBuffer, DATE_TIME_LENGTH, DATE_TIME_FORMAT,
 		localtime(&Time));
-	Value = 0;
-	for (Index = 0; Index < Voters; ++Index)
+	if (not Incremental)
+		Tallies.Clear();
+	if (Tallies.GetPresent() == 0)
 		{
-		CurrentVotesFile.Read(Index, CurrentVote);
-		for (Candidate = 0; Candidate < Candidates; ++Candidate)
-			if (CurrentVote [Candidate] != 0)
-				break;
-		if (Candidate < Candidates)
+		LocalTally.Votes = 0;
+		LocalTally.ElectionVote = ElectionVote;
+		for (Index = 0; Index < Threads; ++Index)
 			{
-			++Value;
-			for (Candidate = 0; Candidate < Candidates; ++Candidate)
-				ElectionVote [Candidate].
-					IncrementCount(CurrentVote [Candidate]);
+			LocalTally.FirstVoter = static_cast<std_uint>(
+				static_cast<std_ulong>(Voters) * Index /
+				Threads);
+			LocalTally.LastVoter = static_cast<std_uint>(
+				static_cast<std_ulong>(Voters) * (Index + 1) /
+				Threads);
+			Tallies.Append(LocalTally);
 			}
 		}
+	for (Index = 1; Index < Threads; ++Index)
+		try
+			{
+			Workers [Index] = std::thread(TallyThread,
+				std::cref(DirectoryPath), Candidates, Voters,
+				MaximumVote, VotesKey, Engine, Shards,
+				Incremental, std::ref(Tallies [Index]));
+			}
+		catch (std::system_error&)
+			{
+			TallyThread(DirectoryPath, Candidates, Voters,
+				MaximumVote, VotesKey, Engine, Shards,
+				Incremental, Tallies [Index]);
+			}
+	try
+		{
+		if (Incremental)
+			CurrentVotesFile.RefreshVotes(Tallies [0].FirstVoter,
+				Tallies [0].LastVoter, Tallies [0].ElectionVote,
+				Tallies [0].Votes, Tallies [0].Generations,
+				Tallies [0].Ballots);
+		else
+			Tallies [0].Votes = CurrentVotesFile.CountVotes(
+				Tallies [0].FirstVoter, Tallies [0].LastVoter,
+				Tallies [0].ElectionVote);
+		}
+	catch (...)
+		{
+		Tallies [0].Error = std::current_exception();
+		}
+	for (Index = 1; Index < Threads; ++Index)
+		if (Workers [Index].joinable())
+			Workers [Index].join();
 	CurrentVotesFile.Close();
+	Voted = 0;
+	for (Index = 0; Index < Threads; ++Index)
+		{
+		if (Tallies [Index].Error)
+			std::rethrow_exception(Tallies [Index].Error);
+		Voted += Tallies [Index].Votes;
+		ElectionVote += Tallies [Index].ElectionVote;
+		}
 	if (printf(ELECTION_HEADER_FORMAT, Candidates, Voters, MaximumVote,
 		TimeBuffer) < 0)
 		throw make_IO_exception(FILE_WRITE_ERROR,
 			CharString(DEFAULT_STDOUT_PATHNAME));
-	if (Voters == Value)
+	if (Voters == Voted)
 		{
 		if (printf(ALL_VOTERS_MESSAGE) < 0)
 			throw make_IO_exception(FILE_WRITE_ERROR,
 				CharString(DEFAULT_STDOUT_PATHNAME));
 		}
 	else
-		if (printf(VOTERS_FORMAT, Value) < 0)
+		if (printf(VOTERS_FORMAT, Voted) < 0)
 			throw make_IO_exception(FILE_WRITE_ERROR,
 				CharString(DEFAULT_STDOUT_PATHNAME));
-	Value = (Value + 1) / 2;
-	for (Candidate = 0; Candidate < Candidates; ++Candidate)
-		ElectionVote [Candidate].ComputeLowerExtreme(Value);
-	LocalVote.ComputeLowerExtreme(Value);
+	ElectionVote.ComputeLowerExtremes((Voted + 1) / 2);
 	if (printf(RESULT_HEADER) < 0)
 		throw make_IO_exception(FILE_WRITE_ERROR,
 			CharString(DEFAULT_STDOUT_PATHNAME));
@@ -224,22 +453,28 @@ static	void	ComputeResult(const CharString& DirectoryPath,
 	if (printf(FILLER_FORMAT, 1, CharacterManager<char>::GetEOLN()) < 0)
 		throw make_IO_exception(FILE_WRITE_ERROR,
 			CharString(DEFAULT_STDOUT_PATHNAME));
-	OrderedVector<CandidateVote>::SortIndices(ElectionVote, OrderedIndex);
+	ElectionVote.SortCandidates(OrderedIndex);
 	Rank = 0;
 	for (Candidate = Candidates; Candidate > 0;)
 		{
 		Index = OrderedIndex [--Candidate];
-		if (ElectionVote [Index] != LocalVote)
-			Rank = Candidates - Candidate;
-		LocalVote = ElectionVote [Index];
+		if (Candidate + 1 < Candidates)
+			{
+			if (not ElectionVote.IsEqual(Index,
+				OrderedIndex [Candidate + 1]))
+				Rank = Candidates - Candidate;
+			}
+		else
+			if (Voted != 0)
+				Rank = 1;
 		if (printf(CANDIDATE_RESULT_FORMAT, Rank, Index,
-			LocalVote.GetLowerExtreme()) < 0)
+			ElectionVote.GetLowerExtreme(Index)) < 0)
 			throw make_IO_exception(FILE_WRITE_ERROR,
 				CharString(DEFAULT_STDOUT_PATHNAME));
 		for (Value = 0; Value <= MaximumVote; ++Value)
 			{
 			if (printf(UNSIGNED_NUMBER_FORMAT, VOTE_FIELD_LENGTH,
-				LocalVote.GetCounter(Value)) < 0)
+				ElectionVote.GetCounter(Index, Value)) < 0)
 				throw make_IO_exception(FILE_WRITE_ERROR,
 					CharString(DEFAULT_STDOUT_PATHNAME));
 			if (printf(FILLER_FORMAT, 1,
@@ -254,12 +489,72 @@ static	void	ComputeResult(const CharString& DirectoryPath,
 		}
 	}
 
+////////////////////////////////////////////////////////////////////////////////
+//! \par	Description:
+//!	Wait until the journal changes and then stops changing, or a given
+//!	time elapses without changes. \n
+//!	The function waits for the first change no longer than TimeInterval,
+//!	and after it until no change happens for RESULT_QUIET_TIME, but no
+//!	longer than RESULT_MAXIMUM_DELAY after the first change.
+//!
+//! \param	JournalPath			Reference to the path name of
+//!						the journal.
+//! \param	Watch				Value returned by WatchFile for
+//!						the journal.
+//! \param	TimeInterval			Maximum time to wait for the
+//!						first change, in milliseconds.
+//!
+//! \throw	utility_space::OUT_OF_MEMORY	If memory allocation fails when
+//!						creating an exception.
+//! \throw	io_space::FILE_READ_ERROR	If an error occurs while reading
+//!						the changes.
+//!
+//! \returns	None.
+//!
+//! \note
+//!	Every vote is acknowledged after it has been appended to the journal,
+//!	and the votes are written into the votes file only while the journal is
+//!	emptied, so each change of the votes changes the journal too; the
+//!	changes made by other processes while the result was computed are not
+//!	discarded, so they are found at once.
+//!
+//! \see	RESULT_QUIET_TIME
+//! \see	RESULT_MAXIMUM_DELAY
+//! \see	NANOSECONDS_PER_MILLISECOND
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+static	void	WaitForVotes(const CharString& JournalPath, int Watch,
+			std_uint TimeInterval)
+			throw(FatalException, IOException)
+	{
+	register	FileManager*	Manager;
+	register	std_ulong	Now;
+	register	std_ulong	Deadline;
+
+	Manager = FileManager::GetInstance();
+	if (not Manager->WaitForChanges(Watch, TimeInterval, JournalPath))
+		return;
+	Now = SystemManager::GetInstance()->GetApplicationTime() /
+		NANOSECONDS_PER_MILLISECOND;
+	Deadline = Now + RESULT_MAXIMUM_DELAY;
+	while (Now < Deadline and Manager->WaitForChanges(Watch,
+		static_cast<std_uint>(Deadline - Now < RESULT_QUIET_TIME ?
+		Deadline - Now : RESULT_QUIET_TIME), JournalPath))
+		Now = SystemManager::GetInstance()->GetApplicationTime() /
+			NANOSECONDS_PER_MILLISECOND;
+	}
+
 ////////////////////////////////////////////////////////////////////////////////
 //! \par	Description:
 //!	Main program for computing the result of the election. \n
 //!	If a time interval is specified, it keeps computing and printing the
 //!	result at regular intervals, until it is killed, otherwise it prints the
-//!	result only once.
+//!	result only once; if the system can notify the changes to the files
+//!	and the election has a journal, an option makes it recompute the result
+//!	when the votes change, or after the given interval without changes. \n
+//!	The number of threads reading the votes can be given with an option
+//!	before the other arguments.
 //!
 //! \param	argc	Number of command line arguments.
 //! \param	argv	Array of command line arguments.
@@ -270,6 +565,11 @@ static	void	ComputeResult(const CharString& DirectoryPath,
 //!			correctly or not.
 //!
 //! \see	ENCRYPTION_KEY_LENGTH
+//! \see	THREADS_OPTION
+//! \see	WATCH_OPTION
+//! \see	NO_WATCH
+//! \see	DEFAULT_RESULT_THREADS
+//! \see	MAXIMUM_RESULT_THREADS
 //! \see	MAXIMUM_RESULT_INTERVAL
 //! \see	MILLISECONDS_PER_MINUTE
 //!
@@ -280,18 +580,49 @@ int	main(int argc, char* argv [])
 	try
 		{
 		register	std_uint	TimeInterval;
+		register	int		Watch;
+				bool		Watching;
 				std_uint	Candidates;
 				std_uint	Voters;
 				std_uint	MaximumVote;
+				std_uint	Engine;
+				std_uint	DecoyVotes;
+				std_uint	SweepVotes;
+				std_uint	Shards;
+				std_uint	Threads;
 				CharString	DirectoryPath;
+				CharString	JournalPath;
 				CharString	KeyPath;
+				Vector<TallyData>	Tallies;
 				byte		VotersKey
 							[ENCRYPTION_KEY_LENGTH];
 				byte		VotesKey
 							[ENCRYPTION_KEY_LENGTH];
 
 		HandleOptions(argc, argv);
-		if (argc < 3 or argc > 4)
+		Threads = DEFAULT_RESULT_THREADS;
+		Watching = false;
+		for (;;)
+			if (argc > 2 and strcmp(argv [1], THREADS_OPTION) == 0)
+				{
+				Threads = DecodeInteger(argv [2]);
+				if (Threads == 0 or
+					Threads > MAXIMUM_RESULT_THREADS)
+					throw make_application_exception(
+						INVALID_THREADS);
+				argc -= 2;
+				argv += 2;
+				}
+			else if (argc > 1 and strcmp(argv [1], WATCH_OPTION) ==
+				0)
+				{
+				Watching = true;
+				--argc;
+				++argv;
+				}
+			else
+				break;
+		if (argc < 3 or argc > 4 or (Watching and argc != 4))
 			{
 			Usage();
 			return EXIT_FAILURE;
@@ -311,14 +642,28 @@ int	main(int argc, char* argv [])
 			TimeInterval = 0;
 		ReadKeys(KeyPath, VotersKey, VotesKey);
 		ReadParameters(DirectoryPath, Candidates, Voters, MaximumVote,
-			VotersKey, VotesKey);
+			VotersKey, VotesKey, Engine, DecoyVotes, SweepVotes,
+			Shards);
+		JournalPath = MakeJournalPathName(DirectoryPath);
+		if (Watching and FileManager::GetInstance()->FileExists(
+			JournalPath))
+			Watch = FileManager::GetInstance()->WatchFile(
+				JournalPath);
+		else
+			Watch = NO_WATCH;
 		for (;;)
 			{
 			ComputeResult(DirectoryPath, Candidates, Voters,
-				MaximumVote, VotersKey, VotesKey);
+				MaximumVote, VotersKey, VotesKey, Engine,
+				DecoyVotes, Shards, Threads, TimeInterval != 0,
+				Tallies, Watch);
 			if (TimeInterval == 0)
 				break;
-			SystemManager::GetInstance()->Sleep(TimeInterval);
+			if (Watch == NO_WATCH)
+				SystemManager::GetInstance()->Sleep(
+					TimeInterval);
+			else
+				WaitForVotes(JournalPath, Watch, TimeInterval);
 			}
 		}
 	catch (ExceptionBase& Exc)
@@ -0,0 +1,405 @@
+////////////////////////////////////////////////////////////////////////////////
+//! \file
+//!
+//! \author	agent
+//!
+//! \date	16/10/2026
+//!
+//! \par	Function:
+//!	It contains the definitions of static attributes and non inline
+//!	functions of the io_space::VoteJournal class.
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+# include	"Standard.h"
+# include	"LocalUtility.h"
+# include	"VoteJournal.h"
+
+# if !defined	USE_INLINE
+# include	"VoteJournal.inl"
+# endif
+
+namespace	io_space
+{
+
+using	namespace	utility_space;
+using	namespace	application_space;
+
+////////////////////////////////////////////////////////////////////////////////
+//! \par	Description:
+//!	Read and decode an entry of the journal.
+//!
+//! \param	Entry				The index of the entry.
+//! \param	CurrentVote			Reference to the struct that
+//!						upon return will contain the
+//!						data of the vote.
+//!
+//! \throw	utility_space::OUT_OF_MEMORY	If memory allocation fails.
+//! \throw	io_space::FILE_NOT_OPEN		If the File is not opened.
+//! \throw	io_space::FILE_READ_ERROR	If an error occurs while
+//!						reading.
+//!
+//! \returns	bool				false if the entry has been
+//!						written only partially, true
+//!						otherwise.
+//!
+//! \see	SIGNATURE_LENGTH
+//! \see	ENCRYPTION_BLOCK_LENGTH
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+bool	VoteJournal::Read(std_uint Entry, register VoteData& CurrentVote)
+		throw(FatalException, IOException)
+	{
+	register	std_uint	Index;
+	register	byte*		Buffer;
+
+	if (EntryBuffer.GetPresent() < EntryLength)
+		{
+		EntryBuffer.Clear();
+		EntryBuffer.Append(0, EntryLength);
+		}
+	Buffer = &EntryBuffer [0];
+	if (ReadAt(Buffer, EntryLength, static_cast<std_ulong>(Entry) *
+		EntryLength) < EntryLength)
+		return false;
+	Encoder.DecryptBlocks(Buffer, Buffer,
+		EntryLength / ENCRYPTION_BLOCK_LENGTH);
+	if (Pack(Buffer) != ComputeChecksum(Buffer + sizeof(std_uint),
+		EntryLength - sizeof(std_uint)))
+		return false;
+	CurrentVote.Voter = Pack(Buffer + sizeof(std_uint));
+	Buffer += JOURNAL_HEADER_BLOCKS * ENCRYPTION_BLOCK_LENGTH;
+	CurrentVote.Vote.Clear();
+	for (Index = 0; Index < Candidates; ++Index)
+		CurrentVote.Vote.Append(VotesFile::GetVote(Buffer [Index]));
+	Buffer += VotesBlocks * ENCRYPTION_BLOCK_LENGTH;
+	for (Index = 0; Index < SIGNATURE_LENGTH; ++Index)
+		CurrentVote.Signature [Index] = Buffer [2 * Index];
+	return true;
+	}
+
+////////////////////////////////////////////////////////////////////////////////
+//! \par	Description:
+//!	Create an empty journal.
+//!
+//! \param	thisPathName				Reference to the path
+//!							name of the file.
+//!
+//! \throw	utility_space::OUT_OF_MEMORY		If memory allocation
+//!							fails.
+//! \throw	io_space::FILE_INVALID_PATH_NAME	If the path name is not
+//!							valid.
+//! \throw	io_space::FILE_PERMISSION_DENIED	If user has no
+//!							permission to open the
+//!							file or if the path name
+//!							corresponds to a
+//!							directory.
+//! \throw	io_space::TOO_MANY_OPEN_FILES		If trying to open too
+//!							many files.
+//! \throw	io_space::FILE_CLOSE_ERROR		If an error occurs while
+//!							closing the file.
+//!
+//! \returns	None.
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+void	VoteJournal::Create(const CharString& thisPathName)
+		throw(FatalException, IOException)
+	{
+	OpenBinary(thisPathName, OPEN_WRITE);
+	File::Close();
+	}
+
+////////////////////////////////////////////////////////////////////////////////
+//! \par	Description:
+//!	Open the journal, if it exists.
+//!
+//! \param	thisPathName				Path name of the file to
+//!							be opened.
+//! \param	thisCandidates				Number of candidates.
+//! \param	Key					Encryption key for the
+//!							votes file.
+//! \param	Engine					Identifier of the cipher
+//!							engine.
+//!
+//! \throw	utility_space::OUT_OF_MEMORY		If memory allocation
+//!							fails.
+//! \throw	utility_space::ILLEGAL_ARGUMENT		If the cipher engine is
+//!							not valid or it is not
+//!							supported by the
+//!							processor.
+//! \throw	io_space::FILE_ALREADY_OPEN		If File is already open.
+//! \throw	io_space::FILE_INVALID_PATH_NAME	If the path name is not
+//!							valid.
+//! \throw	io_space::FILE_PERMISSION_DENIED	If user has no
+//!							permission to open the
+//!							file or if the path name
+//!							corresponds to a
+//!							directory.
+//! \throw	io_space::TOO_MANY_OPEN_FILES		If trying to open too
+//!							many files.
+//!
+//! \returns	bool					true if the journal has
+//!							been opened, false if it
+//!							does not exist.
+//!
+//! \note
+//!	Elections created before the journal was introduced have no such file;
+//!	if the file exists, the votes must be written only through the journal,
+//!	otherwise the entries applied later could overwrite newer votes.
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+bool	VoteJournal::Open(const CharString& thisPathName,
+		std_uint thisCandidates,
+		const byte Key [ENCRYPTION_KEY_LENGTH], std_uint Engine)
+		throw(FatalException, IOException)
+	{
+	if (not FileManager::GetInstance()->FileExists(thisPathName))
+		return false;
+	VotesBlocks = Cryptography::ComputeBlocks(Candidates = thisCandidates);
+	EntryLength = ENCRYPTION_BLOCK_LENGTH *
+		(JOURNAL_HEADER_BLOCKS + VotesBlocks + SignatureBlocks);
+	OpenBinary(thisPathName, OPEN_UPDATE);
+	Encoder.SetEngine(Engine);
+	Encoder.SetKey(Key);
+	Entries = 0;
+	PendingEntries.Clear();
+	return true;
+	}
+
+////////////////////////////////////////////////////////////////////////////////
+//! \par	Description:
+//!	Lock the journal, waiting for the other processes to unlock it, and
+//!	count the entries written into the file.
+//!
+//! \throw	utility_space::OUT_OF_MEMORY		If memory allocation
+//!							fails when creating an
+//!							exception.
+//! \throw	io_space::FILE_NOT_OPEN			If the VoteJournal is
+//!							not opened.
+//! \throw	io_space::FILE_DEADLOCK			If the lock would cause
+//!							a deadlock.
+//! \throw	io_space::TOO_MANY_LOCKS		If there are too many
+//!							locks.
+//!
+//! \returns	None.
+//!
+//! \note
+//!	The entries may have been appended or applied by other processes since
+//!	the journal was locked the latest time.
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+void	VoteJournal::Lock(void) throw(FatalException, IOException)
+	{
+	LockAt(0, 1);
+	Entries = FileManager::GetInstance()->GetFileSize(GetPathName()) /
+		EntryLength;
+	}
+
+////////////////////////////////////////////////////////////////////////////////
+//! \par	Description:
+//!	Unlock the journal.
+//!
+//! \throw	utility_space::OUT_OF_MEMORY		If memory allocation
+//!							fails when creating an
+//!							exception.
+//! \throw	io_space::FILE_NOT_OPEN			If the VoteJournal is
+//!							not opened.
+//!
+//! \returns	None.
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+void	VoteJournal::Unlock(void) throw(FatalException, IOException)
+	{
+	UnlockAt(0, 1);
+	}
+
+////////////////////////////////////////////////////////////////////////////////
+//! \par	Description:
+//!	Encode and encrypt a vote, adding it to the entries to be written.
+//!
+//! \param	CurrentVote			Reference to the struct
+//!						containing the data of the vote.
+//! \param	FillerGenerator			Reference to the random number
+//!						generator used to create random
+//!						fillers.
+//!
+//! \throw	utility_space::OUT_OF_MEMORY	If memory allocation fails.
+//!
+//! \returns	None.
+//!
+//! \note
+//!	The entry is written by the next call to Commit.
+//!
+//! \see	SIGNATURE_LENGTH
+//! \see	ENCRYPTION_BLOCK_LENGTH
+//! \see	BYTE_MAX
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+void	VoteJournal::Append(register const VoteData& CurrentVote,
+		RandomGenerator& FillerGenerator) throw(FatalException)
+	{
+	register	std_uint	Index;
+	register	std_uint	Start;
+	register	byte*		Entry;
+	register	byte*		Votes;
+
+	Start = PendingEntries.GetPresent();
+	PendingEntries.Append(0, EntryLength);
+	Entry = &PendingEntries [Start];
+	Votes = Entry + JOURNAL_HEADER_BLOCKS * ENCRYPTION_BLOCK_LENGTH;
+	VotesFile::MakeVotes(Votes, VotesBlocks * ENCRYPTION_BLOCK_LENGTH,
+		FillerGenerator);
+	for (Index = 0; Index < Candidates; ++Index)
+		Votes [Index] += CurrentVote.Vote [Index];
+	Votes += VotesBlocks * ENCRYPTION_BLOCK_LENGTH;
+	for (Index = 0; Index < SIGNATURE_LENGTH; ++Index)
+		Votes [2 * Index] = CurrentVote.Signature [Index];
+	FillerGenerator.Fill(Votes + 1, SIGNATURE_LENGTH, BYTE_MAX, 2);
+	Unpack(CurrentVote.Voter, Entry + sizeof(std_uint));
+	Unpack(ComputeChecksum(Entry + sizeof(std_uint), EntryLength -
+		sizeof(std_uint)), Entry);
+	Encoder.CryptBlocks(Entry, Entry, EntryLength / ENCRYPTION_BLOCK_LENGTH);
+	}
+
+////////////////////////////////////////////////////////////////////////////////
+//! \par	Description:
+//!	Write the entries added since the latest call and synchronize the
+//!	journal with the disk.
+//!
+//! \throw	utility_space::OUT_OF_MEMORY		If memory allocation
+//!							fails when creating an
+//!							exception.
+//! \throw	io_space::FILE_NOT_OPEN			If the VoteJournal is
+//!							not opened.
+//! \throw	io_space::FILE_WRITE_ERROR		If an error occurs while
+//!							writing.
+//!
+//! \returns	None.
+//!
+//! \note
+//!	The journal must be locked by Lock. The entries are appended with a
+//!	single write and a single synchronization, so that the votes can be
+//!	acknowledged afterwards; then GetEntries returns the number of entries
+//!	in the file, including those appended by other processes.
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+void	VoteJournal::Commit(void) throw(FatalException, IOException)
+	{
+	if (PendingEntries.IsEmpty())
+		return;
+	WriteAt(&PendingEntries [0], PendingEntries.GetPresent(),
+		static_cast<std_ulong>(Entries) * EntryLength);
+	Entries += PendingEntries.GetPresent() / EntryLength;
+	PendingEntries.Clear();
+	SystemFlush();
+	}
+
+////////////////////////////////////////////////////////////////////////////////
+//! \par	Description:
+//!	Write the votes contained in the journal into the votes file, then
+//!	empty the journal.
+//!
+//! \param	CurrentVotesFile			Reference to the votes
+//!							file.
+//! \param	VotersKey				Array that contains the
+//!							encryption key of the
+//!							voters' file.
+//! \param	VotesKey				Array that contains the
+//!							encryption key of the
+//!							votes file.
+//! \param	FillerGenerator				Reference to the random
+//!							number generator used to
+//!							create random record
+//!							fillers.
+//!
+//! \throw	utility_space::OUT_OF_MEMORY		If memory allocation
+//!							fails.
+//! \throw	utility_space::ILLEGAL_ARGUMENT		If a voter does not
+//!							exist.
+//! \throw	io_space::FILE_NOT_OPEN			If the VoteJournal or
+//!							the votes file is not
+//!							opened.
+//! \throw	io_space::FILE_READ_ERROR		If an error occurs while
+//!							reading.
+//! \throw	io_space::FILE_WRITE_ERROR		If an error occurs while
+//!							writing.
+//! \throw	application_spec::CORRUPTED_VOTES_FILE	If the votes file
+//!							contains votes greater
+//!							than the maximum vote.
+//!
+//! \returns	None.
+//!
+//! \note
+//!	The journal must be locked by Lock, so that the entries appended by
+//!	all the processes are applied in the order of their acknowledgement;
+//!	the entries added since the latest call to Commit are committed first.
+//!	The votes are written together, so that a record modified by several
+//!	votes is rewritten only once, and the latest vote of a voter prevails;
+//!	the journal is emptied only after the votes file has been synchronized
+//!	with the disk, so that the function can be repeated after a crash. \n
+//!	The entries written only partially by a process stopped while
+//!	committing them had not been acknowledged and they are skipped.
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+void	VoteJournal::Apply(VotesFile& CurrentVotesFile,
+		const byte VotersKey [ENCRYPTION_KEY_LENGTH],
+		const byte VotesKey [ENCRYPTION_KEY_LENGTH],
+		RandomGenerator& FillerGenerator)
+		throw(FatalException, IOException, ApplicationException)
+	{
+	register	std_uint	Entry;
+
+	Commit();
+	AppliedVotes.Clear();
+	for (Entry = 0; Entry < Entries; ++Entry)
+		if (Read(Entry, AppliedVote))
+			AppliedVotes.Append(AppliedVote);
+	if (not AppliedVotes.IsEmpty())
+		{
+		CurrentVotesFile.WriteVotes(&AppliedVotes [0],
+			AppliedVotes.GetPresent(), VotersKey, VotesKey,
+			FillerGenerator);
+		CurrentVotesFile.SystemFlush();
+		}
+	if (Entries > 0)
+		{
+		Truncate(0);
+		SystemFlush();
+		Entries = 0;
+		}
+	}
+
+////////////////////////////////////////////////////////////////////////////////
+//! \par	Description:
+//!	Close the journal.
+//!
+//! \throw	utility_space::OUT_OF_MEMORY		If memory allocation
+//!							fails when creating an
+//!							exception.
+//! \throw	io_space::FILE_NOT_OPEN			If the VoteJournal is
+//!							not opened.
+//! \throw	io_space::FILE_CLOSE_ERROR		If an error occurs while
+//!							closing the file.
+//!
+//! \returns	None.
+//!
+//! \note
+//!	The entries added after the latest call to Commit are discarded.
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+void	VoteJournal::Close(void) throw(FatalException, IOException)
+	{
+	PendingEntries.Clear();
+	File::Close();
+	}
+
+}
@@ -23,9 +23,11 @@
 # include	"ExceptionHandler.h"
 # include	"GenericString.h"
 # include	"File.h"
+# include	"SystemManager.h"
 # include	"RandomGenerator.h"
 # include	"VotersFile.h"
 # include	"VotesFile.h"
+# include	"VoteJournal.h"
 # include	"Utility.h"
 # include	"LocalUtility.h"
 
@@ -33,6 +35,7 @@ using	namespace	utility_space;
 using	namespace	data_structure_space;
 using	namespace	io_space;
 using	namespace	application_space;
+using	namespace	system_space;
 
 static	void		Usage(void) throw(IOException);
 
@@ -41,12 +44,26 @@ static	std_uint	ReadInteger(const CharString& Line,
 				ApplicationErrorType Error)
 				throw(ApplicationException);
 
+static	void		AcknowledgeVotes(VotesFile& CurrentVotesFile,
+				VoteJournal& CurrentJournal,
+				File& OutputFile,
+				Vector<VoteData>& PendingVotes,
+				const byte VotersKey [ENCRYPTION_KEY_LENGTH],
+				const byte VotesKey [ENCRYPTION_KEY_LENGTH],
+				RandomGenerator& FillerGenerator)
+				throw(FatalException, IOException,
+				ApplicationException);
+
 static	void		HandleVotes(const CharString& DirectoryPath,
 				register std_uint Candidates,
 				register std_uint Voters,
 				register std_uint MaximumVote,
 				const byte VotersKey [ENCRYPTION_KEY_LENGTH],
-				const byte VotesKey [ENCRYPTION_KEY_LENGTH])
+				const byte VotesKey [ENCRYPTION_KEY_LENGTH],
+				std_uint Engine,
+				std_uint DecoyVotes,
+				std_uint Shards,
+				std_uint SynchronizationVotes)
 				throw(FatalException, IOException,
 				ApplicationException);
 
@@ -59,13 +76,14 @@ static	void		HandleVotes(const CharString& DirectoryPath,
 //! \returns	None.
 //!
 //! \see	VOTE_USAGE_FORMAT
+//! \see	MAXIMUM_SYNCHRONIZATION_VOTES
 //! \see	DEFAULT_STDOUT_PATHNAME
 //!
 ////////////////////////////////////////////////////////////////////////////////
 
 static	void	Usage(void) throw(IOException)
 	{
-	if (printf(VOTE_USAGE_FORMAT) < 0)
+	if (printf(VOTE_USAGE_FORMAT, MAXIMUM_SYNCHRONIZATION_VOTES) < 0)
 		throw make_IO_exception(FILE_WRITE_ERROR,
 			CharString(DEFAULT_STDOUT_PATHNAME));
 	}
@@ -152,6 +170,18 @@ static	std_uint	ReadInteger(const CharString& Line,
 //! \param	VotesKey				Array that contains the
 //!							encryption key of the
 //!							votes file.
+//! \param	Engine					Identifier of the cipher
+//!							engine.
+//! \param	DecoyVotes				Minimum number of votes
+//!							modified when a vote is
+//!							written.
+//! \param	Shards					Number of files the
+//!							votes are split into.
+//! \param	SynchronizationVotes			Number of votes written
+//!							between two
+//!							synchronizations of the
+//!							votes file with the
+//!							disk.
 //!
 //! \throw	utility_space::OUT_OF_MEMORY		If memory allocation
 //!							fails.
@@ -209,9 +239,28 @@ static	std_uint	ReadInteger(const CharString& Line,
 //!	the real voter, so that it generates the same sequence of numbers for
 //!	each voter.
 //!
+//! \note
+//!	The votes are collected and written together once every
+//!	SynchronizationVotes votes, so that a record modified by several votes
+//!	of a group is rewritten only once; then the votes file is synchronized
+//!	with the disk and the votes are acknowledged. A partial group is
+//!	written as well when no further vote is ready, when its first vote has
+//!	waited SYNCHRONIZATION_DELAY, before an error is reported, so that the
+//!	messages follow the order of the votes, and when the end of standard
+//!	input is reached.
+//!
+//! \note
+//!	If the election has a journal, the votes are appended to it and
+//!	acknowledged when the journal is synchronized, and the votes file is
+//!	never written directly; the journal, shared with the other voting
+//!	programs, is written into the votes file when it contains at least
+//!	JOURNAL_APPLY_VOTES votes and when the end of standard input is reached.
+//!
 //! \see	ENCRYPTION_KEY_LENGTH
-//! \see	VOTE_SET_FORMAT
 //! \see	DEFAULT_STDOUT_PATHNAME
+//! \see	SYNCHRONIZATION_DELAY
+//! \see	JOURNAL_APPLY_VOTES
+//! \see	NANOSECONDS_PER_MILLISECOND
 //!
 ////////////////////////////////////////////////////////////////////////////////
 
@@ -219,32 +268,57 @@ static	void	HandleVotes(const CharString& DirectoryPath,
 			register std_uint Candidates, register std_uint Voters,
 			register std_uint MaximumVote,
 			const byte VotersKey [ENCRYPTION_KEY_LENGTH],
-			const byte VotesKey [ENCRYPTION_KEY_LENGTH])
+			const byte VotesKey [ENCRYPTION_KEY_LENGTH],
+			std_uint Engine, std_uint DecoyVotes, std_uint Shards,
+			std_uint SynchronizationVotes)
 			throw(FatalException, IOException, ApplicationException)
 	{
 	register	std_uint		VoteIndex;
 	register	std_uint		LineIndex;
 	register	std_uint		LineLength;
 	register	std_uint		SingleVote;
+	register	std_ulong		Now;
+			std_ulong		Deadline;
 			CharString		Line;
 			File			InputFile;
 			File			OutputFile;
 			VotersFile		CurrentVotersFile;
 			VotesFile		CurrentVotesFile;
+			VoteJournal		CurrentJournal;
 			Vector<std_uint>	VoterIndex;
+			Vector<VoteData>	PendingVotes;
 			RandomGenerator		FillerGenerator;
 			RandomGenerator		IndexGenerator;
 			VoteData		CurrentVote;
 
 	InitializeGenerator(FillerGenerator, VotersKey, VotesKey);
 	CurrentVotersFile.Read(MakeVotersPathName(DirectoryPath), Voters,
-		VoterIndex, VotersKey);
+		VoterIndex, VotersKey, Engine);
 	CurrentVotesFile.Open(MakeVotesPathName(DirectoryPath), Candidates,
-		Voters, MaximumVote, VotesKey);
+		Voters, MaximumVote, Shards, VotesKey, Engine);
+	CurrentVotesFile.SetDecoyVotes(DecoyVotes);
+	CurrentVotesFile.OpenLocks(MakeLocksPathName(DirectoryPath));
+	CurrentVotesFile.OpenGenerations(MakeGenerationsPathName(
+		DirectoryPath));
+	CurrentJournal.Open(MakeJournalPathName(DirectoryPath), Candidates,
+		VotesKey, Engine);
 	InputFile.OpenInput();
 	OutputFile.OpenOutput();
+	Deadline = 0;
 	for (;;)
 		{
+		if (not PendingVotes.IsEmpty())
+			{
+			Now = SystemManager::GetInstance()->
+				GetApplicationTime() /
+				NANOSECONDS_PER_MILLISECOND;
+			if (Now >= Deadline or not InputFile.IsInputReady(
+				static_cast<std_uint>(Deadline - Now)))
+				AcknowledgeVotes(CurrentVotesFile,
+					CurrentJournal, OutputFile,
+					PendingVotes, VotersKey, VotesKey,
+					FillerGenerator);
+			}
 		try
 			{
 			InputFile.ReadLine<char>(Line);
@@ -299,22 +373,127 @@ static	void	HandleVotes(const CharString& DirectoryPath,
 			}
 		catch (ApplicationException Exc)
 			{
+			AcknowledgeVotes(CurrentVotesFile, CurrentJournal,
+				OutputFile, PendingVotes, VotersKey, VotesKey,
+				FillerGenerator);
 			ExceptionHandler::GetInstance().
 				HandleApplicationException(Exc);
 			continue;
 			}
-		CurrentVotesFile.WriteVote(CurrentVote, VotersKey, VotesKey,
+		if (CurrentJournal.IsOpened())
+			CurrentJournal.Append(CurrentVote, FillerGenerator);
+		if (PendingVotes.IsEmpty())
+			Deadline = SystemManager::GetInstance()->
+				GetApplicationTime() /
+				NANOSECONDS_PER_MILLISECOND +
+				SYNCHRONIZATION_DELAY;
+		PendingVotes.Append(CurrentVote);
+		if (PendingVotes.GetPresent() >= SynchronizationVotes)
+			AcknowledgeVotes(CurrentVotesFile, CurrentJournal,
+				OutputFile, PendingVotes, VotersKey, VotesKey,
+				FillerGenerator);
+		}
+	AcknowledgeVotes(CurrentVotesFile, CurrentJournal, OutputFile,
+		PendingVotes, VotersKey, VotesKey, FillerGenerator);
+	if (CurrentJournal.IsOpened())
+		{
+		CurrentJournal.Lock();
+		CurrentJournal.Apply(CurrentVotesFile, VotersKey, VotesKey,
 			FillerGenerator);
-		if (fprintf(stdout, VOTE_SET_FORMAT, CurrentVote.Voter + 1) < 0)
-			throw make_IO_exception(FILE_WRITE_ERROR,
-				CharString(DEFAULT_STDOUT_PATHNAME));
-		OutputFile.Flush();
+		CurrentJournal.Unlock();
+		CurrentJournal.Close();
 		}
 	InputFile.Close();
 	OutputFile.Close();
 	CurrentVotesFile.Close();
 	}
 
+////////////////////////////////////////////////////////////////////////////////
+//! \par	Description:
+//!	Synchronize the journal, if open, or write the pending votes into the
+//!	votes file and synchronize it with the disk, then acknowledge the votes;
+//!	the journal is written into the votes file if it contains at least
+//!	JOURNAL_APPLY_VOTES votes.
+//!
+//! \param	CurrentVotesFile			Reference to the votes
+//!							file.
+//! \param	CurrentJournal				Reference to the journal
+//!							of the votes.
+//! \param	OutputFile				Reference to the
+//!							standard output.
+//! \param	PendingVotes				Reference to the vector
+//!							of the votes read since
+//!							the latest
+//!							acknowledgement; it is
+//!							emptied.
+//! \param	VotersKey				Array that contains the
+//!							encryption key of the
+//!							voters' file.
+//! \param	VotesKey				Array that contains the
+//!							encryption key of the
+//!							votes file.
+//! \param	FillerGenerator				Reference to the random
+//!							number generator used to
+//!							create random record
+//!							fillers.
+//!
+//! \throw	utility_space::OUT_OF_MEMORY		If memory allocation
+//!							fails.
+//! \throw	io_space::FILE_NOT_OPEN			If the votes file is not
+//!							opened.
+//! \throw	io_space::FILE_READ_ERROR		If an error occurs while
+//!							reading.
+//! \throw	io_space::FILE_WRITE_ERROR		If an error occurs while
+//!							writing.
+//! \throw	application_spec::CORRUPTED_VOTES_FILE	If the file contains
+//!							votes greater than
+//!							MaximumVote.
+//!
+//! \returns	None.
+//!
+//! \see	VOTE_SET_FORMAT
+//! \see	DEFAULT_STDOUT_PATHNAME
+//! \see	JOURNAL_APPLY_VOTES
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+static	void	AcknowledgeVotes(VotesFile& CurrentVotesFile,
+			VoteJournal& CurrentJournal, File& OutputFile,
+			Vector<VoteData>& PendingVotes,
+			const byte VotersKey [ENCRYPTION_KEY_LENGTH],
+			const byte VotesKey [ENCRYPTION_KEY_LENGTH],
+			RandomGenerator& FillerGenerator)
+			throw(FatalException, IOException, ApplicationException)
+	{
+	register	std_uint	Index;
+
+	if (PendingVotes.IsEmpty())
+		return;
+	if (CurrentJournal.IsOpened())
+		{
+		CurrentJournal.Lock();
+		CurrentJournal.Commit();
+		if (CurrentJournal.GetEntries() >= JOURNAL_APPLY_VOTES)
+			CurrentJournal.Apply(CurrentVotesFile, VotersKey,
+				VotesKey, FillerGenerator);
+		CurrentJournal.Unlock();
+		}
+	else
+		{
+		CurrentVotesFile.WriteVotes(&PendingVotes [0],
+			PendingVotes.GetPresent(), VotersKey, VotesKey,
+			FillerGenerator);
+		CurrentVotesFile.SystemFlush();
+		}
+	for (Index = 0; Index < PendingVotes.GetPresent(); ++Index)
+		if (fprintf(stdout, VOTE_SET_FORMAT,
+			PendingVotes [Index].Voter + 1) < 0)
+			throw make_IO_exception(FILE_WRITE_ERROR,
+				CharString(DEFAULT_STDOUT_PATHNAME));
+	PendingVotes.Clear();
+	OutputFile.Flush();
+	}
+
 ////////////////////////////////////////////////////////////////////////////////
 //! \par	Description:
 //!	Main program for collecting votes. \n
@@ -331,6 +510,8 @@ static	void	HandleVotes(const CharString& DirectoryPath,
 //!			correctly or not.
 //!
 //! \see	ENCRYPTION_KEY_LENGTH
+//! \see	DEFAULT_SYNCHRONIZATION_VOTES
+//! \see	MAXIMUM_SYNCHRONIZATION_VOTES
 //!
 ////////////////////////////////////////////////////////////////////////////////
 
@@ -341,24 +522,41 @@ int	main(int argc, char* argv [])
 		std_uint	Candidates;
 		std_uint	Voters;
 		std_uint	MaximumVote;
+		std_uint	Engine;
+		std_uint	DecoyVotes;
+		std_uint	SweepVotes;
+		std_uint	Shards;
+		std_uint	SynchronizationVotes;
 		CharString	DirectoryPath;
 		CharString	KeyPath;
 		byte		VotersKey [ENCRYPTION_KEY_LENGTH];
 		byte		VotesKey [ENCRYPTION_KEY_LENGTH];
 
 		HandleOptions(argc, argv);
-		if (argc != 3)
+		if (argc < 3 or argc > 4)
 			{
 			Usage();
 			return EXIT_FAILURE;
 			}
 		DirectoryPath = CharString(argv [1]);
 		KeyPath = CharString(argv [2]);
+		if (argc == 4)
+			{
+			SynchronizationVotes = DecodeInteger(argv [3]);
+			if (SynchronizationVotes == 0 or SynchronizationVotes >
+				MAXIMUM_SYNCHRONIZATION_VOTES)
+				throw make_application_exception(
+					INVALID_SYNCHRONIZATION_VOTES);
+			}
+		else
+			SynchronizationVotes = DEFAULT_SYNCHRONIZATION_VOTES;
 		ReadKeys(KeyPath, VotersKey, VotesKey);
 		ReadParameters(DirectoryPath, Candidates, Voters, MaximumVote,
-			VotersKey, VotesKey);
+			VotersKey, VotesKey, Engine, DecoyVotes, SweepVotes,
+			Shards);
 		HandleVotes(DirectoryPath, Candidates, Voters, MaximumVote,
-			VotersKey, VotesKey);
+			VotersKey, VotesKey, Engine, DecoyVotes, Shards,
+			SynchronizationVotes);
 		}
 	catch (ExceptionBase& Exc)
 		{
@@ -37,6 +37,8 @@ using	namespace	application_space;
 //! \param	Voters					Number of voters.
 //! \param	Key					Encryption key for the
 //!							file.
+//! \param	Engine					Identifier of the cipher
+//!							engine.
 //! \param	Generator				Reference to the random
 //!							number generator used to
 //!							sort voters and to
@@ -45,6 +47,10 @@ using	namespace	application_space;
 //!
 //! \throw	utility_space::OUT_OF_MEMORY		If memory allocation
 //!							fails.
+//! \throw	utility_space::ILLEGAL_ARGUMENT		If the cipher engine is
+//!							not valid or it is not
+//!							supported by the
+//!							processor.
 //! \throw	io_space::FILE_INVALID_PATH_NAME	If the path name is not
 //!							valid.
 //! \throw	io_space::FILE_PERMISSION_DENIED	If user has no
@@ -70,17 +76,19 @@ using	namespace	application_space;
 
 void	VotersFile::Create(const CharString& thisPathName,
 		register std_uint Voters,
-		const byte Key [ENCRYPTION_KEY_LENGTH],
+		const byte Key [ENCRYPTION_KEY_LENGTH], std_uint Engine,
 		register RandomGenerator& Generator)
 		throw(FatalException, IOException)
 	{
 	register	std_uint		Index;
 	register	std_uint		SwapIndex;
 	register	std_uint		TempIndex;
+	register	std_uint		Blocks;
 			Cryptography		Encoder;
 			Vector<std_uint>	IndexVector(Voters);
 			byte			Buffer
-						[ENCRYPTION_BLOCK_LENGTH];
+						[CRYPTOGRAPHY_BUFFER_BLOCKS *
+						ENCRYPTION_BLOCK_LENGTH];
 
 	for (Index = 0; Index < Voters; ++Index)
 		IndexVector.Append(Index);
@@ -91,15 +99,23 @@ void	VotersFile::Create(const CharString& thisPathName,
 		IndexVector [SwapIndex] = IndexVector [Index];
 		IndexVector [Index] = TempIndex;
 		}
+	Encoder.SetEngine(Engine);
 	Encoder.SetKey(Key);
 	OpenBinary(thisPathName, OPEN_WRITE, MAXIMUM_BUFFER_SIZE);
-	for (Index = 0; Index < Voters; ++Index)
+	for (Index = Blocks = 0; Index < Voters; ++Index)
 		{
-		Unpack(IndexVector [Index], Buffer);
+		Unpack(IndexVector [Index], Buffer +
+			Blocks * ENCRYPTION_BLOCK_LENGTH);
 		Unpack(Generator.Generate(MAXIMUM_RANDOM_NUMBER),
-			Buffer + sizeof(std_uint));
-		Encoder.Crypt(Buffer, Buffer);
-		Write(Buffer, ENCRYPTION_BLOCK_LENGTH, 1);
+			Buffer + Blocks * ENCRYPTION_BLOCK_LENGTH +
+			sizeof(std_uint));
+		if (++Blocks == CRYPTOGRAPHY_BUFFER_BLOCKS or
+			Index + 1 == Voters)
+			{
+			Encoder.CryptBlocks(Buffer, Buffer, Blocks);
+			Write(Buffer, ENCRYPTION_BLOCK_LENGTH, Blocks);
+			Blocks = 0;
+			}
 		}
 	Close();
 	}
@@ -117,9 +133,15 @@ void	VotersFile::Create(const CharString& thisPathName,
 //!							the voters.
 //! \param	Key					Encryption key for the
 //!							file.
+//! \param	Engine					Identifier of the cipher
+//!							engine.
 //!
 //! \throw	utility_space::OUT_OF_MEMORY		If memory allocation
 //!							fails.
+//! \throw	utility_space::ILLEGAL_ARGUMENT		If the cipher engine is
+//!							not valid or it is not
+//!							supported by the
+//!							processor.
 //! \throw	io_space::FILE_INVALID_PATH_NAME	If the path name is not
 //!							valid.
 //! \throw	io_space::FILE_DOES_NOT_EXIST		If the file does not
@@ -152,27 +174,39 @@ void	VotersFile::Create(const CharString& thisPathName,
 
 void	VotersFile::Read(const CharString& thisPathName,
 		register std_uint Voters, register Vector<std_uint>& VoterIndex,
-		const byte Key [ENCRYPTION_KEY_LENGTH])
+		const byte Key [ENCRYPTION_KEY_LENGTH], std_uint Engine)
 		throw(FatalException, IOException, ApplicationException)
 	{
 	register	std_uint	Index;
+	register	std_uint	Blocks;
 	register	std_uint	Value;
 			Cryptography	Encoder;
-			byte		Buffer [ENCRYPTION_BLOCK_LENGTH];
+			byte		Buffer [CRYPTOGRAPHY_BUFFER_BLOCKS *
+						ENCRYPTION_BLOCK_LENGTH];
 
 	if (FileManager::GetInstance()->GetFileSize(thisPathName) !=
 		Voters * ENCRYPTION_BLOCK_LENGTH)
 		throw make_application_exception(INVALID_VOTERS_FILE_LENGTH);
+	Encoder.SetEngine(Engine);
 	Encoder.SetKey(Key);
 	VoterIndex.Clear();
 	VoterIndex.Resize(Voters);
 	OpenBinary(thisPathName, OPEN_READ, MAXIMUM_BUFFER_SIZE);
 	for (Index = 0; Index < Voters; ++Index)
 		{
-		if (File::Read(Buffer, ENCRYPTION_BLOCK_LENGTH, 1) != 1)
-			throw make_IO_exception(FILE_READ_ERROR, thisPathName);
-		Encoder.Decrypt(Buffer, Buffer);
-		Value = Pack(Buffer);
+		if (Index % CRYPTOGRAPHY_BUFFER_BLOCKS == 0)
+			{
+			Blocks = Voters - Index;
+			if (Blocks > CRYPTOGRAPHY_BUFFER_BLOCKS)
+				Blocks = CRYPTOGRAPHY_BUFFER_BLOCKS;
+			if (File::Read(Buffer, ENCRYPTION_BLOCK_LENGTH, Blocks)
+				!= Blocks)
+				throw make_IO_exception(FILE_READ_ERROR,
+					thisPathName);
+			Encoder.DecryptBlocks(Buffer, Buffer, Blocks);
+			}
+		Value = Pack(Buffer + Index % CRYPTOGRAPHY_BUFFER_BLOCKS *
+			ENCRYPTION_BLOCK_LENGTH);
 		if (Value >= Voters)
 			throw make_application_index_exception(
 				CORRUPTED_VOTERS_FILE, Index);
@@ -26,8 +26,231 @@ using	namespace	application_space;
 
 ////////////////////////////////////////////////////////////////////////////////
 //! \par	Description:
-//!	Write the votes and the signature of a voter.
+//!	Split the voters into shards with balanced ranges of adjacent voters.
 //!
+//! \param	thisShardCount			The number of shards.
+//!
+//! \throw	utility_space::OUT_OF_MEMORY	If memory allocation fails when
+//!						creating an exception.
+//! \throw	utility_space::ILLEGAL_ARGUMENT	If the number of shards is zero
+//!						or greater than MAXIMUM_SHARDS
+//!						or the number of voters.
+//!
+//! \returns	None.
+//!
+//! \see	MAXIMUM_SHARDS
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+void	VotesFile::SetShards(std_uint thisShardCount) throw(FatalException)
+	{
+	register	std_uint	Shard;
+	register	std_uint	Next;
+
+	if (thisShardCount == 0 or thisShardCount > MAXIMUM_SHARDS or
+		thisShardCount > Voters)
+		throw make_fatal_exception(ILLEGAL_ARGUMENT);
+	ShardCount = thisShardCount;
+	for (Shard = 0; Shard < ShardCount; ++Shard)
+		{
+		Shards [Shard].FirstVoter = static_cast<std_uint>(
+			static_cast<std_ulong>(Shard) * Voters / ShardCount);
+		Next = static_cast<std_uint>(static_cast<std_ulong>(Shard + 1) *
+			Voters / ShardCount);
+		Shards [Shard].Voters = Next - Shards [Shard].FirstVoter;
+		Shards [Shard].MappedRecords = nullptr;
+		Shards [Shard].Transfers = 0;
+		}
+	}
+
+////////////////////////////////////////////////////////////////////////////////
+//! \par	Description:
+//!	Create the path name of the file of a shard.
+//!
+//! \param	PathName			Reference to the path name of
+//!						the votes file.
+//! \param	Shard				The index of the shard.
+//!
+//! \throw	utility_space::OUT_OF_MEMORY	If memory allocation fails.
+//!
+//! \returns	CharString			The path name of the votes file
+//!						for the first shard, the path
+//!						name followed by the index of
+//!						the shard otherwise.
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+CharString	VotesFile::MakeShardPathName(const CharString& PathName,
+			std_uint Shard) throw(FatalException)
+	{
+	CharString	Suffix;
+
+	if (Shard == 0)
+		return PathName;
+	Suffix.ToString(Shard);
+	return PathName + Suffix;
+	}
+
+////////////////////////////////////////////////////////////////////////////////
+//! \par	Description:
+//!	Set the records to be rewritten to the indices in RecordSet, in
+//!	increasing order. \n
+//!	The algorithm used is heapsort with a binary heap, performed in place.
+//!
+//! \throw	utility_space::OUT_OF_MEMORY	If memory allocation fails.
+//!
+//! \returns	None.
+//!
+//! \note
+//!	No memory is allocated unless RewriteIndex must grow.
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+void	VotesFile::SortRecords(void) throw(FatalException)
+	{
+	register	std_uint*	Record;
+	register	std_uint	Size;
+	register	std_uint	Parent;
+	register	std_uint	Child;
+	register	std_uint	Value;
+	register	std_uint	Index;
+
+	RewriteIndex.Clear();
+	RewriteIndex.Append(RecordSet.GetElements());
+	if ((Size = RewriteIndex.GetPresent()) < 2)
+		return;
+	Record = &RewriteIndex [0];
+	for (Index = Size / 2 + Size; Index > 0;)
+		{
+		if (Index > Size)
+			Value = Record [Parent = --Index - Size];
+		else
+			{
+			Value = Record [--Index];
+			Record [Index] = Record [0];
+			Size = Index;
+			Parent = 0;
+			}
+		for (; (Child = 2 * Parent + 1) < Size; Parent = Child)
+			{
+			if (Child + 1 < Size and Record [Child + 1] > Record [Child])
+				++Child;
+			if (Record [Child] <= Value)
+				break;
+			Record [Parent] = Record [Child];
+			}
+		Record [Parent] = Value;
+		}
+	}
+
+////////////////////////////////////////////////////////////////////////////////
+//! \par	Description:
+//!	Add to RecordSet the indices of the votes modified when writing a vote:
+//!	the vote itself and a random set of other votes, depending only upon
+//!	the keys and the voter.
+//!
+//! \param	CurrentVote			Reference to the struct
+//!						containing the data of the vote.
+//! \param	VotersKey			Array that contains the
+//!						encryption key of the voters'
+//!						file.
+//! \param	VotesKey			Array that contains the
+//!						encryption key of the votes
+//!						file.
+//!
+//! \throw	utility_space::OUT_OF_MEMORY	If memory allocation fails.
+//!
+//! \returns	None.
+//!
+//! \see	DecoyVotes
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+void	VotesFile::SelectRecords(const VoteData& CurrentVote,
+		const byte VotersKey [ENCRYPTION_KEY_LENGTH],
+		const byte VotesKey [ENCRYPTION_KEY_LENGTH])
+		throw(FatalException)
+	{
+	register	std_uint	Index;
+
+	ignore_value(RecordSet.Insert(CurrentVote.Voter));
+	InitializeGenerator(IndexGenerator, VotersKey, VotesKey,
+		CurrentVote.Voter);
+	for (Index = DecoyVotes + IndexGenerator.Generate(DecoyVotes / 2);
+		Index > 0; --Index)
+		ignore_value(RecordSet.Insert(IndexGenerator.Generate(
+			Voters - 1)));
+	}
+
+////////////////////////////////////////////////////////////////////////////////
+//! \par	Description:
+//!	Add a vote to RewriteVotes, keeping it ordered by voter; a vote of a
+//!	voter already present replaces the previous one.
+//!
+//! \param	CurrentVote			Pointer to the struct containing
+//!						the data of the vote.
+//!
+//! \throw	utility_space::OUT_OF_MEMORY	If memory allocation fails.
+//!
+//! \returns	None.
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+void	VotesFile::AddRewriteVote(const VoteData* CurrentVote)
+		throw(FatalException)
+	{
+	register	std_uint	Low;
+	register	std_uint	High;
+	register	std_uint	Middle;
+
+	for (Low = 0, High = RewriteVotes.GetPresent(); Low < High;)
+		if (RewriteVotes [Middle = Low + (High - Low) / 2]->Voter <
+			CurrentVote->Voter)
+			Low = Middle + 1;
+		else
+			High = Middle;
+	if (Low < RewriteVotes.GetPresent() and
+		RewriteVotes [Low]->Voter == CurrentVote->Voter)
+		RewriteVotes [Low] = CurrentVote;
+	else
+		RewriteVotes.Insert(CurrentVote, Low);
+	}
+
+////////////////////////////////////////////////////////////////////////////////
+//! \par	Description:
+//!	Fill the random part of the signature of a decrypted record.
+//!
+//! \param	Signature		Pointer to the signature part of the
+//!					record; bytes in even positions contain
+//!					the signature and are not changed.
+//! \param	FillerGenerator		Reference to the random number generator
+//!					used to create random record fillers.
+//!
+//! \throw	None.
+//!
+//! \returns	None.
+//!
+//! \see	SIGNATURE_LENGTH
+//! \see	ENCRYPTION_BLOCK_LENGTH
+//! \see	BYTE_MAX
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+void	VotesFile::FillSignature(register byte* Signature,
+		RandomGenerator& FillerGenerator) noexcept
+	{
+	FillerGenerator.Fill(Signature + 1, SIGNATURE_LENGTH, BYTE_MAX, 2);
+	FillerGenerator.Fill(Signature + 2 * SIGNATURE_LENGTH,
+		SignatureBlocks * ENCRYPTION_BLOCK_LENGTH -
+		2 * SIGNATURE_LENGTH, BYTE_MAX);
+	}
+
+////////////////////////////////////////////////////////////////////////////////
+//! \par	Description:
+//!	Store the votes and the signature of a voter in a decrypted record,
+//!	with new random fillers.
+//!
+//! \param	Record				Pointer to the record.
 //! \param	CurrentVote			Reference to struct containing
 //!						the data of the vote.
 //! \param	FillerGenerator			Reference to the random number
@@ -35,76 +258,304 @@ using	namespace	application_space;
 //!						record fillers.
 //!
 //! \throw	utility_space::OUT_OF_MEMORY	If memory allocation fails.
-//! \throw	io_space::FILE_NOT_OPEN		If the File is not opened.
-//! \throw	io_space::FILE_SEEK_ERROR	If the File cannot be seeked.
-//! \throw	io_space::FILE_WRITE_ERROR	If an error occurs while
-//!						writing.
 //!
 //! \returns	None.
 //!
 //! \see	SIGNATURE_LENGTH
 //! \see	ENCRYPTION_BLOCK_LENGTH
-//! \see	SIGNATURE_LENGTH
-//! \see	BYTE_MAX
 //!
 ////////////////////////////////////////////////////////////////////////////////
 
-void	VotesFile::WriteSingleVote(register const VoteData& CurrentVote,
-		register RandomGenerator& FillerGenerator)
-		throw(FatalException, IOException)
+void	VotesFile::EncodeRecord(register byte* Record,
+		register const VoteData& CurrentVote,
+		RandomGenerator& FillerGenerator) throw(FatalException)
+	{
+	register	std_uint	Index;
+
+	MakeVotes(Record, VotesBlocks * ENCRYPTION_BLOCK_LENGTH,
+		FillerGenerator);
+	for (Index = 0; Index < CurrentVote.Vote.GetPresent() and
+		Index < VotesBlocks * ENCRYPTION_BLOCK_LENGTH; ++Index)
+		Record [Index] += CurrentVote.Vote [Index];
+	Record += VotesBlocks * ENCRYPTION_BLOCK_LENGTH;
+	for (Index = 0; Index < SIGNATURE_LENGTH; ++Index)
+		Record [2 * Index] = CurrentVote.Signature [Index];
+	FillSignature(Record, FillerGenerator);
+	}
+
+////////////////////////////////////////////////////////////////////////////////
+//! \par	Description:
+//!	Replace the random fillers of a decrypted record, leaving the votes and
+//!	the signature unchanged.
+//!
+//! \param	Record					Pointer to the record.
+//! \param	FillerGenerator				Reference to the random
+//!							number generator used to
+//!							create random record
+//!							fillers.
+//!
+//! \throw	application_spec::CORRUPTED_VOTES_FILE	If the record contains
+//!							votes greater than
+//!							MaximumVote.
+//!
+//! \returns	None.
+//!
+//! \see	CRYPTOGRAPHY_BUFFER_BLOCKS
+//! \see	ENCRYPTION_BLOCK_LENGTH
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+void	VotesFile::RefreshRecord(register byte* Record,
+		RandomGenerator& FillerGenerator) throw(ApplicationException)
 	{
 	register	std_uint	Index;
-			byte		Buffer [ENCRYPTION_BLOCK_LENGTH];
+	register	std_uint	Count;
+	register	std_uint	Value;
+			byte		Buffer [CRYPTOGRAPHY_BUFFER_BLOCKS *
+						ENCRYPTION_BLOCK_LENGTH];
 
-	Seek(CurrentVote.Voter * RecordLength, FILE_SEEK_SET);
-	for (Index = 0; Index < CurrentVote.Vote.GetPresent(); Index)
+	for (Index = 0; Index < VotesBlocks * ENCRYPTION_BLOCK_LENGTH; ++Index)
 		{
-		Buffer [Index % ENCRYPTION_BLOCK_LENGTH] =
-			MakeVote(CurrentVote.Vote [Index], FillerGenerator);
-		if (++Index % ENCRYPTION_BLOCK_LENGTH == 0)
+		if (Index % sizeof(Buffer) == 0)
 			{
-			Encoder.Crypt(Buffer, Buffer);
-			File::Write(Buffer, ENCRYPTION_BLOCK_LENGTH, 1);
+			Count = VotesBlocks * ENCRYPTION_BLOCK_LENGTH - Index;
+			if (Count > sizeof(Buffer))
+				Count = sizeof(Buffer);
+			MakeVotes(Buffer, Count, FillerGenerator);
 			}
+		Value = GetVote(Record [Index]);
+		if (Index < Candidates ? Value > MaximumVote : Value != 0)
+			throw make_application_exception(CORRUPTED_VOTES_FILE);
+		Record [Index] = Buffer [Index % sizeof(Buffer)] + Value;
 		}
-	if ((Index %= ENCRYPTION_BLOCK_LENGTH) != 0)
+	FillSignature(Record + VotesBlocks * ENCRYPTION_BLOCK_LENGTH,
+		FillerGenerator);
+	}
+
+////////////////////////////////////////////////////////////////////////////////
+//! \par	Description:
+//!	Rewrite a group of records with new random fillers, setting the vote of
+//!	a voter. \n
+//!	Each run of adjacent records of the same shard is locked, decrypted and
+//!	encrypted with a single operation. \n
+//!	If batches of transfers are asynchronous, all the runs of each shard are
+//!	read with a single batch and then written with another one, so that the
+//!	device can perform them in parallel; otherwise they are decrypted and
+//!	encrypted directly from and to the mapped files, if possible.
+//!
+//! \param	First				Index in RewriteIndex of the
+//!						first record to rewrite.
+//! \param	Records				Number of records to rewrite.
+//! \param	NextVote			Reference to the index in
+//!						RewriteVotes of the first vote
+//!						not yet written; upon return it
+//!						is advanced past the votes
+//!						written.
+//! \param	FillerGenerator			Reference to the random number
+//!						generator used to create random
+//!						record fillers.
+//!
+//! \throw	utility_space::OUT_OF_MEMORY		If memory allocation
+//!							fails.
+//! \throw	io_space::FILE_NOT_OPEN			If the VotesFile is not
+//!							opened.
+//! \throw	io_space::FILE_READ_ERROR		If an error occurs while
+//!							reading.
+//! \throw	io_space::FILE_WRITE_ERROR		If an error occurs while
+//!							writing.
+//! \throw	application_spec::CORRUPTED_VOTES_FILE	If the file contains
+//!							votes greater than
+//!							MaximumVote.
+//!
+//! \returns	None.
+//!
+//! \note
+//!	The records are locked in increasing order, so that processes rewriting
+//!	overlapping groups cannot deadlock, and they are unlocked only after
+//!	having been written; the shared lock table is used if it has been
+//!	opened, file locks otherwise. \n
+//!	The decrypted records are never stored in the mapped file, so that
+//!	they cannot be written to the disk.
+//!
+//! \note
+//!	If the table of generations has been opened, the generation of each
+//!	vote written is advanced after writing its record and before unlocking
+//!	it.
+//!
+//! \see	ENCRYPTION_BLOCK_LENGTH
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+void	VotesFile::RewriteGroup(std_uint First, std_uint Records,
+		std_uint& NextVote, RandomGenerator& FillerGenerator)
+		throw(FatalException, IOException, ApplicationException)
+	{
+	register	std_uint	Index;
+	register	std_uint	Next;
+	register	std_uint	Length;
+	register	std_uint	Shard;
+	register	std_uint	Vote;
+	register	std_ulong	Offset;
+	register	byte*		Buffer;
+	register	bool		Asynchronous;
+			BatchTransfer	Transfer;
+
+	if (RewriteBuffer.GetPresent() < Records * RecordLength)
 		{
-		while (Index != ENCRYPTION_BLOCK_LENGTH)
-			Buffer [Index++] = MakeVote(0, FillerGenerator);
-		Encoder.Crypt(Buffer, Buffer);
-		File::Write(Buffer, ENCRYPTION_BLOCK_LENGTH, 1);
+		RewriteBuffer.Clear();
+		RewriteBuffer.Append(0, Records * RecordLength);
 		}
-	for (Index = 0; Index < 2 * SIGNATURE_LENGTH;)
+	Buffer = &RewriteBuffer [0];
+	Asynchronous = Shards [0].Records.IsBatchAsynchronous();
+	RewriteTransfers.Clear();
+	for (Shard = 0; Shard < ShardCount; ++Shard)
+		Shards [Shard].Transfers = 0;
+	if (Locks.IsOpened())
+		Locks.Lock(&RewriteIndex [First], Records);
+	for (Index = First; Index < First + Records; Index = Next)
 		{
-		Buffer [Index++ % ENCRYPTION_BLOCK_LENGTH] =
-			CurrentVote.Signature [Index];
-		Buffer [Index++ % ENCRYPTION_BLOCK_LENGTH] =
-			FillerGenerator.Generate(BYTE_MAX);
-		if (Index % ENCRYPTION_BLOCK_LENGTH == 0)
+		Next = GetRunEnd(RewriteIndex, Index, First + Records);
+		Shard = GetShard(RewriteIndex [Index]);
+		Offset = GetOffset(Shard, RewriteIndex [Index]);
+		Length = (Next - Index) * RecordLength;
+		if (not Locks.IsOpened())
+			Shards [Shard].Records.LockAt(Offset, Length);
+		if (Asynchronous)
 			{
-			Encoder.Crypt(Buffer, Buffer);
-			File::Write(Buffer, ENCRYPTION_BLOCK_LENGTH, 1);
+			Transfer.Buffer = Buffer + (Index - First) *
+				RecordLength;
+			Transfer.Size = Length;
+			Transfer.Offset = Offset;
+			RewriteTransfers.Append(Transfer);
+			++Shards [Shard].Transfers;
 			}
+		else
+			LoadBlocks(Shard, Buffer + (Index - First) *
+				RecordLength, Offset, Length /
+				ENCRYPTION_BLOCK_LENGTH);
+		}
+	if (Asynchronous)
+		{
+		for (Shard = Index = 0; Shard < ShardCount;
+			Index += Shards [Shard++].Transfers)
+			if (Shards [Shard].Transfers > 0)
+				Shards [Shard].Records.ReadBatch(
+					&RewriteTransfers [Index],
+					Shards [Shard].Transfers);
+		Encoder.DecryptBlocks(Buffer, Buffer,
+			Records * RecordLength / ENCRYPTION_BLOCK_LENGTH);
+		}
+	Vote = NextVote;
+	for (Index = 0; Index < Records; ++Index)
+		if (NextVote < RewriteVotes.GetPresent() and
+			RewriteIndex [First + Index] ==
+			RewriteVotes [NextVote]->Voter)
+			EncodeRecord(Buffer + Index * RecordLength,
+				*RewriteVotes [NextVote++], FillerGenerator);
+		else
+			RefreshRecord(Buffer + Index * RecordLength,
+				FillerGenerator);
+	if (Asynchronous)
+		{
+		Encoder.CryptBlocks(Buffer, Buffer,
+			Records * RecordLength / ENCRYPTION_BLOCK_LENGTH);
+		for (Shard = Index = 0; Shard < ShardCount;
+			Index += Shards [Shard++].Transfers)
+			if (Shards [Shard].Transfers > 0)
+				Shards [Shard].Records.WriteBatch(
+					&RewriteTransfers [Index],
+					Shards [Shard].Transfers);
 		}
-	if ((Index %= ENCRYPTION_BLOCK_LENGTH) != 0)
+	for (Index = First; Index < First + Records; Index = Next)
+		{
+		Next = GetRunEnd(RewriteIndex, Index, First + Records);
+		Shard = GetShard(RewriteIndex [Index]);
+		Offset = GetOffset(Shard, RewriteIndex [Index]);
+		Length = (Next - Index) * RecordLength;
+		if (not Asynchronous)
+			StoreBlocks(Shard, Offset, Buffer + (Index - First) *
+				RecordLength, Length / ENCRYPTION_BLOCK_LENGTH);
+		if (Generations.IsOpened())
+			for (; Vote < NextVote and RewriteVotes [Vote]->Voter <=
+				RewriteIndex [Next - 1]; ++Vote)
+				Generations.Advance(RewriteVotes [Vote]->Voter);
+		if (not Locks.IsOpened())
+			Shards [Shard].Records.UnlockAt(Offset, Length);
+		if (Shards [Shard].MappedRecords != nullptr)
+			for (; Index < Next; ++Index)
+				DirtyIndex.Append(RewriteIndex [Index]);
+		}
+	if (Locks.IsOpened())
+		Locks.Unlock();
+	}
+
+////////////////////////////////////////////////////////////////////////////////
+//! \par	Description:
+//!	Rewrite the records listed in RewriteIndex with new random fillers,
+//!	setting the votes listed in RewriteVotes, in groups that fit in
+//!	REWRITE_BUFFER_SIZE bytes.
+//!
+//! \param	FillerGenerator			Reference to the random number
+//!						generator used to create random
+//!						record fillers.
+//!
+//! \throw	utility_space::OUT_OF_MEMORY		If memory allocation
+//!							fails.
+//! \throw	io_space::FILE_NOT_OPEN			If the VotesFile is not
+//!							opened.
+//! \throw	io_space::FILE_READ_ERROR		If an error occurs while
+//!							reading.
+//! \throw	io_space::FILE_WRITE_ERROR		If an error occurs while
+//!							writing.
+//! \throw	application_spec::CORRUPTED_VOTES_FILE	If the file contains
+//!							votes greater than
+//!							MaximumVote.
+//!
+//! \returns	None.
+//!
+//! \note
+//!	The random fillers are generated in the same order as rewriting one
+//!	record at a time.
+//!
+//! \see	REWRITE_BUFFER_SIZE
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+void	VotesFile::RewriteRecords(RandomGenerator& FillerGenerator)
+		throw(FatalException, IOException, ApplicationException)
+	{
+	register	std_uint	First;
+	register	std_uint	Records;
+	register	std_uint	MaximumRecords;
+			std_uint	NextVote;
+
+	if ((MaximumRecords = REWRITE_BUFFER_SIZE / RecordLength) == 0)
+		MaximumRecords = 1;
+	NextVote = 0;
+	for (First = 0; First < RewriteIndex.GetPresent(); First += Records)
 		{
-		while (Index != ENCRYPTION_BLOCK_LENGTH)
-			Buffer [Index++] = FillerGenerator.Generate(BYTE_MAX);
-		Encoder.Crypt(Buffer, Buffer);
-		File::Write(Buffer, ENCRYPTION_BLOCK_LENGTH, 1);
+		Records = RewriteIndex.GetPresent() - First;
+		if (Records > MaximumRecords)
+			Records = MaximumRecords;
+		RewriteGroup(First, Records, NextVote, FillerGenerator);
 		}
+	assert(NextVote == RewriteVotes.GetPresent());
 	}
 
 ////////////////////////////////////////////////////////////////////////////////
 //! \par	Description:
-//!	Create a file containing for the votes.
+//!	Create the files containing the votes.
 //!
 //! \param	thisPathName				Reference to the path
-//!							name of the file.
+//!							name of the file of the
+//!							first shard.
 //! \param	thisCandidates				Number of candidates.
-//! \param	Voters					Number of voters.
+//! \param	thisVoters				Number of voters.
+//! \param	thisShardCount				Number of shards.
 //! \param	Key					Encryption key for the
 //!							file.
+//! \param	Engine					Identifier of the cipher
+//!							engine.
 //! \param	Generator				Reference to the random
 //!							number generator used to
 //!							create random record
@@ -112,6 +563,12 @@ void	VotesFile::WriteSingleVote(register const VoteData& CurrentVote,
 //!
 //! \throw	utility_space::OUT_OF_MEMORY		If memory allocation
 //!							fails.
+//! \throw	utility_space::ILLEGAL_ARGUMENT		If the cipher engine is
+//!							not valid or it is not
+//!							supported by the
+//!							processor or if the
+//!							number of shards is not
+//!							valid.
 //! \throw	io_space::FILE_INVALID_PATH_NAME	If the path name is not
 //!							valid.
 //! \throw	io_space::FILE_PERMISSION_DENIED	If user has no
@@ -128,68 +585,112 @@ void	VotesFile::WriteSingleVote(register const VoteData& CurrentVote,
 //!
 //! \returns	None.
 //!
+//! \note
+//!	The records are generated in the same sequence for any number of
+//!	shards, so that the concatenation of the files of the shards is the
+//!	same as the file of a single shard.
+//!
 //! \see	ENCRYPTION_KEY_LENGTH
 //! \see	ENCRYPTION_BLOCK_LENGTH
 //! \see	MAXIMUM_BUFFER_SIZE
 //! \see	SIGNATURE_LENGTH
 //! \see	BYTE_MAX
+//! \see	MAXIMUM_SHARDS
 //!
 ////////////////////////////////////////////////////////////////////////////////
 
 void	VotesFile::Create(const CharString& thisPathName,
-		register std_uint thisCandidates, register std_uint Voters,
-		const byte Key [ENCRYPTION_KEY_LENGTH],
-		register RandomGenerator& Generator)
+		register std_uint thisCandidates, std_uint thisVoters,
+		std_uint thisShardCount, const byte Key [ENCRYPTION_KEY_LENGTH],
+		std_uint Engine, register RandomGenerator& Generator)
 		throw(FatalException, IOException)
 	{
 	register	std_uint	Index;
-	register	std_uint	BufferIndex;
-			Cryptography	Encoder;
-			byte		Buffer [ENCRYPTION_BLOCK_LENGTH];
+	register	std_uint	Length;
+	register	std_uint	Count;
+	register	std_uint	Voter;
+	register	std_uint	Shard;
+			byte		Buffer [CRYPTOGRAPHY_BUFFER_BLOCKS *
+						ENCRYPTION_BLOCK_LENGTH];
 
 	VotesBlocks = Cryptography::ComputeBlocks(Candidates = thisCandidates);
+	Voters = thisVoters;
+	SetShards(thisShardCount);
+	Encoder.SetEngine(Engine);
 	Encoder.SetKey(Key);
-	OpenBinary(thisPathName, OPEN_WRITE, MAXIMUM_BUFFER_SIZE);
-	for (; Voters > 0; --Voters)
+	for (Shard = 0; Shard < ShardCount; ++Shard)
 		{
-		for (Index = 0; Index++ < VotesBlocks;)
-			{
-			for (BufferIndex = 0;
-				BufferIndex < ENCRYPTION_BLOCK_LENGTH;)
-				Buffer [BufferIndex++] = MakeVote(0, Generator);
-			Encoder.Crypt(Buffer, Buffer);
-			File::Write(Buffer, ENCRYPTION_BLOCK_LENGTH, 1);
-			}
-		for (Index = 0; Index++ < SignatureBlocks;)
+		Shards [Shard].Records.OpenBinary(MakeShardPathName(
+			thisPathName, Shard), OPEN_WRITE, MAXIMUM_BUFFER_SIZE);
+		for (Length = 0, Voter = Shards [Shard].Voters; Voter > 0;
+			--Voter)
 			{
-			for (BufferIndex = 0;
-				BufferIndex < ENCRYPTION_BLOCK_LENGTH;)
+			for (Index = 0; Index < VotesBlocks *
+				ENCRYPTION_BLOCK_LENGTH; Index += Count)
 				{
-				Buffer [BufferIndex++] = 0;
-				Buffer [BufferIndex++] =
-					Generator.Generate(BYTE_MAX);
+				Count = VotesBlocks * ENCRYPTION_BLOCK_LENGTH -
+					Index;
+				if (Count > sizeof(Buffer) - Length)
+					Count = sizeof(Buffer) - Length;
+				MakeVotes(Buffer + Length, Count, Generator);
+				if ((Length += Count) == sizeof(Buffer))
+					{
+					WriteBlocks(Shards [Shard].Records,
+						Buffer,
+						CRYPTOGRAPHY_BUFFER_BLOCKS);
+					Length = 0;
+					}
+				}
+			for (Index = 0; Index < SignatureBlocks *
+				ENCRYPTION_BLOCK_LENGTH; Index += Count)
+				{
+				Count = SignatureBlocks *
+					ENCRYPTION_BLOCK_LENGTH - Index;
+				if (Count > sizeof(Buffer) - Length)
+					Count = sizeof(Buffer) - Length;
+				ignore_value(memset(Buffer + Length, 0, Count));
+				Generator.Fill(Buffer + Length + 1, Count / 2,
+					BYTE_MAX, 2);
+				if ((Length += Count) == sizeof(Buffer))
+					{
+					WriteBlocks(Shards [Shard].Records,
+						Buffer,
+						CRYPTOGRAPHY_BUFFER_BLOCKS);
+					Length = 0;
+					}
 				}
-			Encoder.Crypt(Buffer, Buffer);
-			File::Write(Buffer, ENCRYPTION_BLOCK_LENGTH, 1);
 			}
+		if (Length != 0)
+			WriteBlocks(Shards [Shard].Records, Buffer, Length /
+				ENCRYPTION_BLOCK_LENGTH);
+		Shards [Shard].Records.Close();
 		}
-	Close();
 	}
 
 ////////////////////////////////////////////////////////////////////////////////
 //! \par	Description:
-//!	Open the votes file for reading and writing.
+//!	Open the files of the shards of the votes for reading and writing and
+//!	map them in memory.
 //!
-//! \param	thisPathName				Path name of the file to
-//!							be opened.
+//! \param	thisPathName				Path name of the file of
+//!							the first shard.
 //! \param	thisCandidates				Number of candidates.
 //! \param	thisVoters				Number of voters.
 //! \param	thisMaximumVote				Maximum possible vote.
+//! \param	thisShardCount				Number of shards.
 //! \param	Key					Encryption key for the
 //!							file.
+//! \param	Engine					Identifier of the cipher
+//!							engine.
 //!
 //! \throw	utility_space::OUT_OF_MEMORY		If memory allocation
 //!							fails.
+//! \throw	utility_space::ILLEGAL_ARGUMENT		If the cipher engine is
+//!							not valid or it is not
+//!							supported by the
+//!							processor or if the
+//!							number of shards is not
+//!							valid.
 //! \throw	io_space::FILE_ALREADY_OPEN		If File is already open.
 //! \throw	io_space::FILE_INVALID_PATH_NAME	If the path name is not
 //!							valid.
@@ -202,30 +703,236 @@ void	VotesFile::Create(const CharString& thisPathName,
 //!							directory.
 //! \throw	io_space::TOO_MANY_OPEN_FILES		If trying to open too
 //!							many files.
-//! \throw	application_space::INVALID_VOTES_FILE_LENGTH	If the file
-//!							length is not correct.
+//! \throw	application_space::INVALID_VOTES_FILE_LENGTH	If the length
+//!							of a file is not
+//!							correct.
 //!
 //! \returns	None.
 //!
+//! \note
+//!	If the file of a shard cannot be mapped, its records are read and
+//!	written with positional operations on the file.
+//!
 //! \see	ENCRYPTION_BLOCK_LENGTH
 //!
 ////////////////////////////////////////////////////////////////////////////////
 
 void	VotesFile::Open(const CharString& thisPathName, std_uint thisCandidates,
 		std_uint thisVoters, std_uint thisMaximumVote,
-		const byte Key [ENCRYPTION_KEY_LENGTH])
+		std_uint thisShardCount, const byte Key [ENCRYPTION_KEY_LENGTH],
+		std_uint Engine)
 		throw(FatalException, IOException, ApplicationException)
 	{
+	register	std_uint	Shard;
+
 	VotesBlocks = Cryptography::ComputeBlocks(Candidates = thisCandidates);
 	RecordLength =
 		ENCRYPTION_BLOCK_LENGTH * (VotesBlocks + SignatureBlocks);
 	Voters = thisVoters;
 	MaximumVote = thisMaximumVote;
-	if (FileManager::GetInstance()->GetFileSize(thisPathName) !=
-		Voters * RecordLength)
-		throw make_application_exception(INVALID_VOTES_FILE_LENGTH);
-	OpenBinary(thisPathName, OPEN_UPDATE, MAXIMUM_BUFFER_SIZE);
+	SetShards(thisShardCount);
+	for (Shard = 0; Shard < ShardCount; ++Shard)
+		if (FileManager::GetInstance()->GetFileSize(MakeShardPathName(
+			thisPathName, Shard)) != static_cast<std_ulong>(
+			Shards [Shard].Voters) * RecordLength)
+			throw make_application_exception(
+				INVALID_VOTES_FILE_LENGTH);
+	Encoder.SetEngine(Engine);
 	Encoder.SetKey(Key);
+	DirtyIndex.Clear();
+	for (Shard = 0; Shard < ShardCount; ++Shard)
+		{
+		register	VotesShard&	CurrentShard = Shards [Shard];
+
+		CurrentShard.Records.OpenBinary(MakeShardPathName(thisPathName,
+			Shard), OPEN_UPDATE, MAXIMUM_BUFFER_SIZE);
+		try
+			{
+			CurrentShard.MappedRecords = static_cast<byte*>(
+				CurrentShard.Records.Map(static_cast<std_ulong>(
+				CurrentShard.Voters) * RecordLength));
+			}
+		catch (IOException Exc)
+			{
+			CurrentShard.MappedRecords = nullptr;
+			}
+		}
+	}
+
+////////////////////////////////////////////////////////////////////////////////
+//! \par	Description:
+//!	Open the table of the locks of the records shared by the processes
+//!	modifying the votes, if it exists; otherwise the records are protected
+//!	by file locks.
+//!
+//! \param	LocksPathName				Path name of the lock
+//!							table.
+//!
+//! \throw	utility_space::OUT_OF_MEMORY		If memory allocation
+//!							fails.
+//! \throw	io_space::FILE_ALREADY_OPEN		If the lock table is
+//!							already open.
+//! \throw	io_space::FILE_INVALID_PATH_NAME	If the path name is not
+//!							valid.
+//! \throw	io_space::FILE_PERMISSION_DENIED	If user has no
+//!							permission to open the
+//!							file or if the path name
+//!							corresponds to a
+//!							directory.
+//! \throw	io_space::TOO_MANY_OPEN_FILES		If trying to open too
+//!							many files.
+//! \throw	io_space::FILE_IO_ERROR			If the lock table cannot
+//!							be mapped.
+//! \throw	io_space::TOO_MANY_LOCKS		If the locks cannot be
+//!							created.
+//! \throw	application_space::INVALID_LOCKS_FILE_LENGTH	If the file
+//!							length is not correct.
+//!
+//! \returns	None.
+//!
+//! \note
+//!	Elections created before the lock table was introduced have no such
+//!	file; all the processes modifying the votes of an election must use the
+//!	same kind of locks.
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+void	VotesFile::OpenLocks(const CharString& LocksPathName)
+		throw(FatalException, IOException, ApplicationException)
+	{
+	if (FileManager::GetInstance()->FileExists(LocksPathName))
+		Locks.Open(LocksPathName);
+	}
+
+////////////////////////////////////////////////////////////////////////////////
+//! \par	Description:
+//!	Open the table of the generations of the votes shared by the processes
+//!	modifying and reading the votes, if it exists.
+//!
+//! \param	GenerationsPathName			Path name of the table
+//!							of generations.
+//!
+//! \throw	utility_space::OUT_OF_MEMORY		If memory allocation
+//!							fails.
+//! \throw	io_space::FILE_ALREADY_OPEN		If the table is already
+//!							open.
+//! \throw	io_space::FILE_INVALID_PATH_NAME	If the path name is not
+//!							valid.
+//! \throw	io_space::FILE_PERMISSION_DENIED	If user has no
+//!							permission to open the
+//!							file or if the path name
+//!							corresponds to a
+//!							directory.
+//! \throw	io_space::TOO_MANY_OPEN_FILES		If trying to open too
+//!							many files.
+//! \throw	io_space::FILE_IO_ERROR			If the table cannot be
+//!							mapped.
+//! \throw	application_space::INVALID_GENERATIONS_FILE_LENGTH	If the
+//!							file length is not
+//!							correct.
+//!
+//! \returns	None.
+//!
+//! \note
+//!	Elections created before the table of generations was introduced have
+//!	no such file; all the processes writing votes must open the table, if it
+//!	exists, otherwise RefreshVotes cannot detect the votes they write.
+//!
+//! \see	RefreshVotes
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+void	VotesFile::OpenGenerations(const CharString& GenerationsPathName)
+		throw(FatalException, IOException, ApplicationException)
+	{
+	if (FileManager::GetInstance()->FileExists(GenerationsPathName))
+		Generations.Open(GenerationsPathName, Voters);
+	}
+
+////////////////////////////////////////////////////////////////////////////////
+//! \par	Description:
+//!	Remove the mappings of the files of the shards and close them, together
+//!	with the lock table and the table of generations, if open.
+//!
+//! \throw	utility_space::OUT_OF_MEMORY		If memory allocation
+//!							fails when creating an
+//!							exception.
+//! \throw	io_space::FILE_NOT_OPEN			If the VotesFile is not
+//!							opened.
+//! \throw	io_space::FILE_CLOSE_ERROR		If an error occurs while
+//!							closing the file.
+//!
+//! \returns	None.
+//!
+//! \note
+//!	The modified records are not synchronized with the disk: SystemFlush
+//!	must be called before, if needed.
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+void	VotesFile::Close(void) throw(FatalException, IOException)
+	{
+	register	std_uint	Shard;
+
+	if (Locks.IsOpened())
+		Locks.Close();
+	if (Generations.IsOpened())
+		Generations.Close();
+	for (Shard = 0; Shard < ShardCount; ++Shard)
+		{
+		register	VotesShard&	CurrentShard = Shards [Shard];
+
+		if (CurrentShard.MappedRecords != nullptr)
+			{
+			CurrentShard.Records.Unmap(CurrentShard.MappedRecords,
+				static_cast<std_ulong>(CurrentShard.Voters) *
+				RecordLength);
+			CurrentShard.MappedRecords = nullptr;
+			}
+		CurrentShard.Records.Close();
+		}
+	DirtyIndex.Clear();
+	}
+
+////////////////////////////////////////////////////////////////////////////////
+//! \par	Description:
+//!	Write the records modified since the latest call to the disk.
+//!
+//! \throw	utility_space::OUT_OF_MEMORY		If memory allocation
+//!							fails when creating an
+//!							exception.
+//! \throw	io_space::FILE_NOT_OPEN			If the VotesFile is not
+//!							opened.
+//! \throw	io_space::FILE_WRITE_ERROR		If an error occurs while
+//!							writing.
+//!
+//! \returns	None.
+//!
+//! \note
+//!	When the file of a shard is mapped, only the pages containing the
+//!	modified records are written, once for each run of adjacent records.
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+void	VotesFile::SystemFlush(void) throw(FatalException, IOException)
+	{
+	register	std_uint	Index;
+	register	std_uint	Next;
+	register	std_uint	Shard;
+
+	for (Shard = 0; Shard < ShardCount; ++Shard)
+		if (Shards [Shard].MappedRecords == nullptr)
+			Shards [Shard].Records.SystemFlush();
+	for (Index = 0; Index < DirtyIndex.GetPresent(); Index = Next)
+		{
+		Next = GetRunEnd(DirtyIndex, Index, DirtyIndex.GetPresent());
+		Shard = GetShard(DirtyIndex [Index]);
+		Shards [Shard].Records.SynchronizeMap(
+			Shards [Shard].MappedRecords + GetOffset(Shard,
+			DirtyIndex [Index]), static_cast<std_ulong>(Next -
+			Index) * RecordLength);
+		}
+	DirtyIndex.Clear();
 	}
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -239,10 +946,10 @@ void	VotesFile::Open(const CharString& thisPathName, std_uint thisCandidates,
 //!
 //! \throw	utility_space::OUT_OF_MEMORY		If memory allocation
 //!							fails.
+//! \throw	utility_space::ILLEGAL_ARGUMENT		If the voter does not
+//!							exist.
 //! \throw	io_space::FILE_NOT_OPEN			If the File is not
 //!							opened.
-//! \throw	io_space::FILE_SEEK_ERROR		If the File cannot be
-//!							seeked.
 //! \throw	io_space::FILE_READ_ERROR		If an error occurs while
 //!							reading.
 //! \throw	application_spec::CORRUPTED_VOTES_FILE	If the file contains
@@ -261,32 +968,39 @@ void	VotesFile::Read(std_uint Voter, register Vector<std_uint>& Vote)
 		throw(FatalException, IOException, ApplicationException)
 	{
 	register	std_uint	Index;
+	register	std_uint	Blocks;
 	register	std_uint	Value;
-			byte		Buffer [ENCRYPTION_BLOCK_LENGTH];
+	register	std_uint	Shard;
+	register	std_ulong	Offset;
+			byte		Buffer [CRYPTOGRAPHY_BUFFER_BLOCKS *
+						ENCRYPTION_BLOCK_LENGTH];
 
-	Seek(Voter * RecordLength, FILE_SEEK_SET);
+	if (Voter >= Voters)
+		throw make_fatal_exception(ILLEGAL_ARGUMENT);
+	Offset = GetOffset(Shard = GetShard(Voter), Voter);
 	Vote.Clear();
-	Vote.Resize(Candidates);
+	if (Vote.GetSize() < Candidates)
+		Vote.Resize(Candidates);
 	for (Index = 0; Index < VotesBlocks * ENCRYPTION_BLOCK_LENGTH; ++Index)
 		{
-		if (Index % ENCRYPTION_BLOCK_LENGTH == 0)
+		if (Index % sizeof(Buffer) == 0)
 			{
-			if (File::Read(Buffer, ENCRYPTION_BLOCK_LENGTH, 1) < 1)
-				throw make_IO_exception(FILE_READ_ERROR,
-					GetPathName());
-			Encoder.Decrypt(Buffer, Buffer);
+			Blocks = VotesBlocks - Index / ENCRYPTION_BLOCK_LENGTH;
+			if (Blocks > CRYPTOGRAPHY_BUFFER_BLOCKS)
+				Blocks = CRYPTOGRAPHY_BUFFER_BLOCKS;
+			LoadBlocks(Shard, Buffer, Offset + Index, Blocks);
 			}
-		Value = GetVote(Buffer [Index % ENCRYPTION_BLOCK_LENGTH]);
+		Value = GetVote(Buffer [Index % sizeof(Buffer)]);
 		if (Index < Candidates)
 			{
 			if (Value > MaximumVote)
-				make_application_exception(
+				throw make_application_exception(
 					CORRUPTED_VOTES_FILE);
 			Vote.Append(Value);
 			}
 		else
 			if (Value != 0)
-				make_application_exception(
+				throw make_application_exception(
 					CORRUPTED_VOTES_FILE);
 		}
 	}
@@ -303,10 +1017,10 @@ void	VotesFile::Read(std_uint Voter, register Vector<std_uint>& Vote)
 //!
 //! \throw	utility_space::OUT_OF_MEMORY		If memory allocation
 //!							fails.
+//! \throw	utility_space::ILLEGAL_ARGUMENT		If the voter does not
+//!							exist.
 //! \throw	io_space::FILE_NOT_OPEN			If the File is not
 //!							opened.
-//! \throw	io_space::FILE_SEEK_ERROR		If the File cannot be
-//!							seeked.
 //! \throw	io_space::FILE_READ_ERROR		If an error occurs while
 //!							reading.
 //! \throw	application_spec::CORRUPTED_VOTES_FILE	If the file contains
@@ -325,21 +1039,215 @@ void	VotesFile::Read(std_uint Voter, register VoteData& CurrentVote)
 		throw(FatalException, IOException, ApplicationException)
 	{
 	register	std_uint	Index;
-			byte		Buffer [ENCRYPTION_BLOCK_LENGTH];
+	register	std_uint	Shard;
+			byte		Buffer [CRYPTOGRAPHY_BUFFER_BLOCKS *
+						ENCRYPTION_BLOCK_LENGTH];
 
 	Read(Voter, CurrentVote.Vote);
 	CurrentVote.Voter = Voter;
-	for (Index = 0; Index < 2 * SIGNATURE_LENGTH; Index += 2)
+	Shard = GetShard(Voter);
+	LoadBlocks(Shard, Buffer, GetOffset(Shard, Voter) + VotesBlocks *
+		ENCRYPTION_BLOCK_LENGTH, SignatureBlocks);
+	for (Index = 0; Index < SIGNATURE_LENGTH; ++Index)
+		CurrentVote.Signature [Index] = Buffer [2 * Index];
+	}
+
+////////////////////////////////////////////////////////////////////////////////
+//! \par	Description:
+//!	Count the votes of a range of voters.
+//!
+//! \param	FirstVoter				Index of the first voter
+//!							of the range.
+//! \param	LastVoter				Index of the voter
+//!							following the last one
+//!							of the range.
+//! \param	ElectionVote				Reference to the
+//!							ElectionTally containing
+//!							the numbers of votes of
+//!							each candidate,
+//!							incremented upon return.
+//!
+//! \throw	utility_space::OUT_OF_MEMORY		If memory allocation
+//!							fails.
+//! \throw	utility_space::ILLEGAL_ARGUMENT		If the range is not
+//!							valid or the number of
+//!							candidates or the
+//!							maximum vote of the
+//!							ElectionTally differ
+//!							from the ones of the
+//!							file.
+//! \throw	io_space::FILE_NOT_OPEN			If the File is not
+//!							opened.
+//! \throw	io_space::FILE_READ_ERROR		If an error occurs while
+//!							reading.
+//! \throw	application_spec::CORRUPTED_VOTES_FILE	If the file contains
+//!							votes greater than
+//!							MaximumVote.
+//!
+//! \returns	std_uint				The number of voters of
+//!							the range who have
+//!							voted.
+//!
+//! \note
+//!	The votes of each voter are decrypted into a buffer and counted directly
+//!	from their encoded form, without reading the signature.
+//!
+//! \see	ENCRYPTION_BLOCK_LENGTH
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+std_uint	VotesFile::CountVotes(std_uint FirstVoter, std_uint LastVoter,
+			ElectionTally& ElectionVote)
+			throw(FatalException, IOException, ApplicationException)
+	{
+	register	std_uint	Voter;
+	register	std_uint	Shard;
+	register	std_uint	Votes;
+	register	byte*		Buffer;
+			Vector<byte>	VotesBuffer(VotesBlocks *
+						ENCRYPTION_BLOCK_LENGTH);
+
+	if (FirstVoter > LastVoter or LastVoter > Voters or
+		ElectionVote.GetCandidates() != Candidates or
+		ElectionVote.GetMaximumVote() != MaximumVote)
+		throw make_fatal_exception(ILLEGAL_ARGUMENT);
+	VotesBuffer.Append(0, VotesBlocks * ENCRYPTION_BLOCK_LENGTH);
+	Buffer = &VotesBuffer [0];
+	Votes = 0;
+	for (Voter = FirstVoter; Voter < LastVoter; ++Voter)
 		{
-		if (Index % ENCRYPTION_BLOCK_LENGTH == 0)
+		Shard = GetShard(Voter);
+		LoadBlocks(Shard, Buffer, GetOffset(Shard, Voter), VotesBlocks);
+		if (ElectionVote.Count(Buffer))
+			++Votes;
+		}
+	return Votes;
+	}
+
+////////////////////////////////////////////////////////////////////////////////
+//! \par	Description:
+//!	Update the numbers of votes of a range of voters counted by a previous
+//!	call, reading again only the votes written since then. \n
+//!	For each voter the function keeps the generation of the vote counted
+//!	and its decrypted votes: if the generation has changed, the new votes
+//!	are counted and the previous ones are removed.
+//!
+//! \param	FirstVoter				Index of the first voter
+//!							of the range.
+//! \param	LastVoter				Index of the voter
+//!							following the last one
+//!							of the range.
+//! \param	ElectionVote				Reference to the
+//!							ElectionTally containing
+//!							the numbers of votes of
+//!							each candidate, updated
+//!							upon return.
+//! \param	Votes					Reference to the number
+//!							of voters of the range
+//!							who have voted, updated
+//!							upon return.
+//! \param	VoterGenerations			Reference to the Vector
+//!							containing the
+//!							generations of the votes
+//!							counted, empty before
+//!							the first call.
+//! \param	Ballots					Reference to the Vector
+//!							containing the votes
+//!							counted, Candidates
+//!							bytes for each voter,
+//!							empty before the first
+//!							call.
+//!
+//! \throw	utility_space::OUT_OF_MEMORY		If memory allocation
+//!							fails or the votes of
+//!							the range do not fit
+//!							into a Vector.
+//! \throw	utility_space::ILLEGAL_ARGUMENT		If the range is not
+//!							valid or the number of
+//!							candidates or the
+//!							maximum vote of the
+//!							ElectionTally differ
+//!							from the ones of the
+//!							file or the Vectors do
+//!							not correspond to the
+//!							range.
+//! \throw	io_space::FILE_NOT_OPEN			If the File is not
+//!							opened.
+//! \throw	io_space::FILE_READ_ERROR		If an error occurs while
+//!							reading.
+//! \throw	application_spec::CORRUPTED_VOTES_FILE	If the file contains
+//!							votes greater than
+//!							MaximumVote.
+//!
+//! \returns	None.
+//!
+//! \note
+//!	At the first call all the votes of the range are read, as by
+//!	CountVotes; if the table of generations has not been opened, all the
+//!	votes are read again at every call.
+//!
+//! \note
+//!	The generation is read before the record, so that a vote being written
+//!	while it is read is read again at the next call.
+//!
+//! \see	CountVotes
+//! \see	OpenGenerations
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+void	VotesFile::RefreshVotes(std_uint FirstVoter, std_uint LastVoter,
+		ElectionTally& ElectionVote, std_uint& Votes,
+		Vector<std_uint>& VoterGenerations, Vector<byte>& Ballots)
+		throw(FatalException, IOException, ApplicationException)
+	{
+	register	std_uint	Voter;
+	register	std_uint	Shard;
+	register	std_uint	Generation;
+	register	byte*		Buffer;
+	register	byte*		Ballot;
+	register	bool		Initial;
+			Vector<byte>	VotesBuffer(VotesBlocks *
+						ENCRYPTION_BLOCK_LENGTH);
+
+	if (FirstVoter > LastVoter or LastVoter > Voters or
+		ElectionVote.GetCandidates() != Candidates or
+		ElectionVote.GetMaximumVote() != MaximumVote)
+		throw make_fatal_exception(ILLEGAL_ARGUMENT);
+	if (LastVoter - FirstVoter > STD_UINT_MAX / Candidates)
+		throw make_fatal_exception(OUT_OF_MEMORY);
+	if ((Initial = VoterGenerations.GetPresent() == 0))
+		{
+		VoterGenerations.Append(0, LastVoter - FirstVoter);
+		Ballots.Clear();
+		Ballots.Append(0, (LastVoter - FirstVoter) * Candidates);
+		}
+	else
+		if (VoterGenerations.GetPresent() != LastVoter - FirstVoter or
+			Ballots.GetPresent() != (LastVoter - FirstVoter) *
+			Candidates)
+			throw make_fatal_exception(ILLEGAL_ARGUMENT);
+	if (FirstVoter == LastVoter)
+		return;
+	VotesBuffer.Append(0, VotesBlocks * ENCRYPTION_BLOCK_LENGTH);
+	Buffer = &VotesBuffer [0];
+	for (Voter = FirstVoter; Voter < LastVoter; ++Voter)
+		{
+		if (Generations.IsOpened())
 			{
-			if (File::Read(Buffer, ENCRYPTION_BLOCK_LENGTH, 1) < 1)
-				throw make_IO_exception(FILE_READ_ERROR,
-					GetPathName());
-			Encoder.Decrypt(Buffer, Buffer);
+			Generation = Generations.GetGeneration(Voter);
+			if (not Initial and Generation ==
+				VoterGenerations [Voter - FirstVoter])
+				continue;
+			VoterGenerations [Voter - FirstVoter] = Generation;
 			}
-		CurrentVote.Signature [Index / 2] =
-			Buffer [Index % ENCRYPTION_BLOCK_LENGTH];
+		Shard = GetShard(Voter);
+		LoadBlocks(Shard, Buffer, GetOffset(Shard, Voter), VotesBlocks);
+		if (ElectionVote.Count(Buffer))
+			++Votes;
+		Ballot = &Ballots [(Voter - FirstVoter) * Candidates];
+		if (ElectionVote.Uncount(Ballot))
+			--Votes;
+		ignore_value(memcpy(Ballot, Buffer, Candidates));
 		}
 	}
 
@@ -363,10 +1271,10 @@ void	VotesFile::Read(std_uint Voter, register VoteData& CurrentVote)
 //!
 //! \throw	utility_space::OUT_OF_MEMORY		If memory allocation
 //!							fails.
+//! \throw	utility_space::ILLEGAL_ARGUMENT		If the voter does not
+//!							exist.
 //! \throw	io_space::FILE_NOT_OPEN			If the VotesFile is not
 //!							opened.
-//! \throw	io_space::FILE_SEEK_ERROR		If the votes file cannot
-//!							be seeked.
 //! \throw	io_space::FILE_READ_ERROR		If an error occurs while
 //!							reading.
 //! \throw	io_space::FILE_WRITE_ERROR		If an error occurs while
@@ -378,12 +1286,16 @@ void	VotesFile::Read(std_uint Voter, register VoteData& CurrentVote)
 //! \returns	None.
 //!
 //! \note
-//!	The file is locked during the operation, to ensure the integrity of the
-//!	data.
+//!	The modified records are locked during the operation, to ensure the
+//!	integrity of the data; adjacent records are read and written together.
+//!
+//! \note
+//!	The modified records are not synchronized with the disk: SystemFlush
+//!	must be called before acknowledging the vote; it can be called once for
+//!	a group of votes.
 //!
 //! \see	ENCRYPTION_KEY_LENGTH
 //! \see	RANDOM_VOTES
-//! \see	STD_UINT_MAX
 //!
 ////////////////////////////////////////////////////////////////////////////////
 
@@ -393,38 +1305,90 @@ void	VotesFile::WriteVote(const VoteData& CurrentVote,
 		register RandomGenerator& FillerGenerator)
 		throw(FatalException, IOException, ApplicationException)
 	{
+	if (CurrentVote.Voter >= Voters)
+		throw make_fatal_exception(ILLEGAL_ARGUMENT);
+	RecordSet.Clear();
+	SelectRecords(CurrentVote, VotersKey, VotesKey);
+	SortRecords();
+	RewriteVotes.Clear();
+	RewriteVotes.Append(&CurrentVote);
+	RewriteRecords(FillerGenerator);
+	}
+
+////////////////////////////////////////////////////////////////////////////////
+//! \par	Description:
+//!	Write a group of votes, modifying once the union of the records that
+//!	writing each vote would modify.
+//!
+//! \param	Votes					Array containing the
+//!							data of the votes to be
+//!							written.
+//! \param	Count					Number of votes.
+//! \param	VotersKey				Array that contains the
+//!							encryption key of the
+//!							voters' file.
+//! \param	VotesKey				Array that contains the
+//!							encryption key of the
+//!							votes file.
+//! \param	FillerGenerator				Reference to the random
+//!							number generator used to
+//!							create random record
+//!							fillers.
+//!
+//! \throw	utility_space::OUT_OF_MEMORY		If memory allocation
+//!							fails.
+//! \throw	utility_space::ILLEGAL_ARGUMENT		If some voter does not
+//!							exist.
+//! \throw	io_space::FILE_NOT_OPEN			If the VotesFile is not
+//!							opened.
+//! \throw	io_space::FILE_READ_ERROR		If an error occurs while
+//!							reading.
+//! \throw	io_space::FILE_WRITE_ERROR		If an error occurs while
+//!							writing.
+//! \throw	application_spec::CORRUPTED_VOTES_FILE	If the file contains
+//!							votes greater than
+//!							MaximumVote.
+//!
+//! \returns	None.
+//!
+//! \note
+//!	A record selected by several votes is rewritten only once, with the
+//!	vote of its voter if it is in the group; if a voter appears more than
+//!	once, the latest vote is written, as when writing the votes one at a
+//!	time. \n
+//!	All the records are rewritten in a single pass in increasing order,
+//!	with the same locking as WriteVote.
+//!
+//! \note
+//!	The modified records are not synchronized with the disk: SystemFlush
+//!	must be called before acknowledging the votes.
+//!
+//! \see	WriteVote
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+void	VotesFile::WriteVotes(const VoteData* Votes, std_uint Count,
+		const byte VotersKey [ENCRYPTION_KEY_LENGTH],
+		const byte VotesKey [ENCRYPTION_KEY_LENGTH],
+		register RandomGenerator& FillerGenerator)
+		throw(FatalException, IOException, ApplicationException)
+	{
 	register	std_uint	Index;
-	register	std_uint	VoterIndex;
-	register	std_uint	LatestIndex;
 
-	RandomIndex.Append(CurrentVote.Voter);
-	InitializeGenerator(IndexGenerator, VotersKey, VotesKey,
-		CurrentVote.Voter);
-	for (Index = RANDOM_VOTES + IndexGenerator.Generate(RANDOM_VOTES / 2);
-		Index > 0; --Index)
-		RandomIndex.Append(IndexGenerator.Generate(Voters - 1));
-	OrderedIndex = RandomIndex;
-	LatestIndex = STD_UINT_MAX;
-	for (Index = 0; Index < OrderedIndex.GetPresent(); ++Index)
+	for (Index = 0; Index < Count; ++Index)
+		if (Votes [Index].Voter >= Voters)
+			throw make_fatal_exception(ILLEGAL_ARGUMENT);
+	if (Count == 0)
+		return;
+	RecordSet.Clear();
+	RewriteVotes.Clear();
+	for (Index = 0; Index < Count; ++Index)
 		{
-		if ((VoterIndex = OrderedIndex [Index]) != LatestIndex)
-			{
-			if (VoterIndex == CurrentVote.Voter)
-				{
-				Seek(OrderedIndex [Index] * RecordLength,
-					FILE_SEEK_SET);
-				Lock(RecordLength);
-				WriteSingleVote(CurrentVote, FillerGenerator);
-				Seek(OrderedIndex [Index] * RecordLength,
-					FILE_SEEK_SET);
-				Unlock(RecordLength);
-				}
-			else
-				Modify(OrderedIndex [Index], FillerGenerator);
-			LatestIndex = VoterIndex;
-			}
-		SystemFlush();
+		SelectRecords(Votes [Index], VotersKey, VotesKey);
+		AddRewriteVote(Votes + Index);
 		}
+	SortRecords();
+	RewriteRecords(FillerGenerator);
 	}
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -439,10 +1403,10 @@ void	VotesFile::WriteVote(const VoteData& CurrentVote,
 //!
 //! \throw	utility_space::OUT_OF_MEMORY		If memory allocation
 //!							fails.
+//! \throw	utility_space::ILLEGAL_ARGUMENT		If the voter does not
+//!							exist.
 //! \throw	io_space::FILE_NOT_OPEN			If the VotesFile is not
 //!							opened.
-//! \throw	io_space::FILE_SEEK_ERROR		If the votes file cannot
-//!							be seeked.
 //! \throw	io_space::FILE_READ_ERROR		If an error occurs while
 //!							reading.
 //! \throw	io_space::FILE_WRITE_ERROR		If an error occurs while
@@ -462,14 +1426,64 @@ void	VotesFile::WriteVote(const VoteData& CurrentVote,
 void	VotesFile::Modify(std_uint Voter, RandomGenerator& FillerGenerator)
 		throw(FatalException, IOException, ApplicationException)
 	{
-	VoteData	CurrentVote;
-
-	Seek(Voter * RecordLength, FILE_SEEK_SET);
-	Lock(RecordLength);
-	Read(Voter, CurrentVote);
-	WriteSingleVote(CurrentVote, FillerGenerator);
-	Seek(Voter * RecordLength, FILE_SEEK_SET);
-	Unlock(RecordLength);
+	if (Voter >= Voters)
+		throw make_fatal_exception(ILLEGAL_ARGUMENT);
+	RewriteIndex.Clear();
+	RewriteIndex.Append(Voter);
+	RewriteVotes.Clear();
+	RewriteRecords(FillerGenerator);
+	}
+
+////////////////////////////////////////////////////////////////////////////////
+//! \par	Description:
+//!	Modify the fillers of a number of randomly chosen voters.
+//!
+//! \param	Records					Number of voters to be
+//!							chosen.
+//! \param	FillerGenerator				Reference to the random
+//!							number generator used to
+//!							choose the voters and to
+//!							create random record
+//!							fillers.
+//!
+//! \throw	utility_space::OUT_OF_MEMORY		If memory allocation
+//!							fails.
+//! \throw	utility_space::ILLEGAL_ARGUMENT		If the number of voters
+//!							is zero or greater than
+//!							MAXIMUM_SWEEP_VOTES.
+//! \throw	io_space::FILE_NOT_OPEN			If the VotesFile is not
+//!							opened.
+//! \throw	io_space::FILE_READ_ERROR		If an error occurs while
+//!							reading.
+//! \throw	io_space::FILE_WRITE_ERROR		If an error occurs while
+//!							writing.
+//! \throw	application_spec::CORRUPTED_VOTES_FILE	If the file contains
+//!							votes greater than
+//!							MaximumVote.
+//!
+//! \returns	None.
+//!
+//! \note
+//!	A voter chosen more than once is modified only once; the modified
+//!	records are locked during the operation and adjacent records are read
+//!	and written together, as when a vote is written.
+//!
+//! \see	MAXIMUM_SWEEP_VOTES
+//!
+////////////////////////////////////////////////////////////////////////////////
+
+void	VotesFile::Sweep(std_uint Records, RandomGenerator& FillerGenerator)
+		throw(FatalException, IOException, ApplicationException)
+	{
+	if (Records == 0 or Records > MAXIMUM_SWEEP_VOTES)
+		throw make_fatal_exception(ILLEGAL_ARGUMENT);
+	RecordSet.Clear();
+	for (; Records > 0; --Records)
+		ignore_value(RecordSet.Insert(FillerGenerator.Generate(
+			Voters - 1)));
+	SortRecords();
+	RewriteVotes.Clear();
+	RewriteRecords(FillerGenerator);
 	}
 
 }